@@ -0,0 +1,240 @@
+#include "AutoPlace.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+// ================================
+// LAYERED AUTO-PLACEMENT IMPLEMENTATION
+// ================================
+
+// Room left between columns for wire jogs, and between stacked gates, in grid cells
+static const int COLUMN_GAP_CELLS = 3;
+static const int ROW_GAP_CELLS = 1;
+
+// Barycenter rounds, each a sweep right and a sweep back
+static const int BARYCENTER_ROUNDS = 4;
+
+// Edges at each node in compact form: node n's are edges[start[n] .. start[n + 1])
+struct NodeEdges {
+    std::vector<int> start;
+    std::vector<int> edges;     // Indices into CircuitDescription::edges
+};
+
+// Edges leaving (outgoing) or entering each node; edges naming a missing node are left out
+static NodeEdges CollectEdges(const CircuitDescription& circuit, bool outgoing) {
+    int nodeCount = (int)circuit.nodes.size();
+    auto valid = [nodeCount](const NetlistEdge& edge) {
+        return edge.fromNode >= 0 && edge.fromNode < nodeCount && edge.toNode >= 0 && edge.toNode < nodeCount;
+    };
+
+    // Count, prefix-sum, then fill
+    NodeEdges result;
+    result.start.assign(nodeCount + 1, 0);
+    for (const NetlistEdge& edge : circuit.edges) {
+        if (valid(edge)) result.start[(outgoing ? edge.fromNode : edge.toNode) + 1]++;
+    }
+    for (int n = 0; n < nodeCount; n++) {
+        result.start[n + 1] += result.start[n];
+    }
+    result.edges.resize(result.start.back());
+    std::vector<int> fill(result.start.begin(), result.start.end() - 1);
+    for (int e = 0; e < (int)circuit.edges.size(); e++) {
+        const NetlistEdge& edge = circuit.edges[e];
+        if (valid(edge)) result.edges[fill[outgoing ? edge.fromNode : edge.toNode]++] = e;
+    }
+    return result;
+}
+
+// Round to the grid, or up to it (slack for float error, so exact multiples stay put)
+static float SnapToGrid(float value, float gridSize) {
+    return std::round(value / gridSize) * gridSize;
+}
+
+static float SnapUpToGrid(float value, float gridSize) {
+    return std::ceil(value / gridSize - 1e-4f) * gridSize;
+}
+
+std::vector<NodePosition> PlaceLayered(const CircuitDescription& circuit, const std::vector<NodeExtent>& extents,
+    float gridSize) {
+    int nodeCount = (int)circuit.nodes.size();
+    std::vector<NodePosition> positions(nodeCount);
+    if (nodeCount == 0) return positions;
+
+    NodeEdges out = CollectEdges(circuit, true);
+    NodeEdges in = CollectEdges(circuit, false);
+
+    // Break loops: search depth first from the INPUT nodes, then from other nodes nothing
+    // drives, then from whatever is left. An edge back to a node still on the stack
+    // closes a loop and is left out of the layering.
+    std::vector<char> state(nodeCount, 0);      // 0 unseen, 1 on the stack, 2 finished
+    std::vector<char> backward(circuit.edges.size(), 0);
+    std::vector<int> finished;                  // Nodes in the order their search finished
+    finished.reserve(nodeCount);
+    std::vector<std::pair<int, int>> stack;     // (node, next position in out.edges)
+    auto search = [&](int root) {
+        if (state[root] != 0) return;
+        state[root] = 1;
+        stack.push_back(std::make_pair(root, out.start[root]));
+        while (!stack.empty()) {
+            int node = stack.back().first;
+            if (stack.back().second < out.start[node + 1]) {
+                int edge = out.edges[stack.back().second++];
+                int next = circuit.edges[edge].toNode;
+                if (state[next] == 1) {
+                    backward[edge] = 1;
+                }
+                else if (state[next] == 0) {
+                    state[next] = 1;
+                    stack.push_back(std::make_pair(next, out.start[next]));
+                }
+                continue;
+            }
+            state[node] = 2;
+            finished.push_back(node);
+            stack.pop_back();
+        }
+    };
+    for (int n = 0; n < nodeCount; n++) {
+        if (circuit.nodes[n].type == GateType::INPUT) search(n);
+    }
+    for (int n = 0; n < nodeCount; n++) {
+        if (in.start[n] == in.start[n + 1]) search(n);
+    }
+    for (int n = 0; n < nodeCount; n++) {
+        search(n);
+    }
+
+    // Reverse finishing order is topological once the backward edges are gone, so one
+    // pass gives every node its longest path from a source
+    std::vector<int> order(finished.rbegin(), finished.rend());
+    std::vector<int> level(nodeCount, 0);
+    int lastLevel = 0;
+    for (int node : order) {
+        for (int k = out.start[node]; k < out.start[node + 1]; k++) {
+            int edge = out.edges[k];
+            if (backward[edge]) continue;
+            int next = circuit.edges[edge].toNode;
+            level[next] = std::max(level[next], level[node] + 1);
+        }
+        if (circuit.nodes[node].type != GateType::OUTPUT) lastLevel = std::max(lastLevel, level[node] + 1);
+    }
+    for (int n = 0; n < nodeCount; n++) {
+        if (circuit.nodes[n].type == GateType::OUTPUT) level[n] = lastLevel;
+    }
+    int columnCount = *std::max_element(level.begin(), level.end()) + 1;
+
+    // Bucket nodes into columns, in topological order to start with
+    std::vector<int> columnStart(columnCount + 1, 0);
+    for (int n = 0; n < nodeCount; n++) {
+        columnStart[level[n] + 1]++;
+    }
+    for (int c = 0; c < columnCount; c++) {
+        columnStart[c + 1] += columnStart[c];
+    }
+    std::vector<int> columnNodes(nodeCount);
+    std::vector<int> fill(columnStart.begin(), columnStart.end() - 1);
+    for (int node : order) {
+        columnNodes[fill[level[node]]++] = node;
+    }
+
+    // Rank of each node within its column, scaled to 0..1 so columns of any size compare
+    std::vector<double> rank(nodeCount, 0.0);
+    auto setRanks = [&](int column) {
+        int begin = columnStart[column], size = columnStart[column + 1] - begin;
+        for (int i = 0; i < size; i++) {
+            rank[columnNodes[begin + i]] = (i + 0.5) / size;
+        }
+    };
+    for (int c = 0; c < columnCount; c++) {
+        setRanks(c);
+    }
+
+    // Barycenter: sort a column by the mean rank of its nodes' drivers (sweeping right)
+    // or loads (sweeping back); nodes with neither keep their place
+    std::vector<double> key(nodeCount, 0.0);
+    auto sortColumn = [&](int column, const NodeEdges& neighbours, bool drivers) {
+        int begin = columnStart[column], end = columnStart[column + 1];
+        for (int i = begin; i < end; i++) {
+            int node = columnNodes[i];
+            double sum = 0;
+            int count = 0;
+            for (int k = neighbours.start[node]; k < neighbours.start[node + 1]; k++) {
+                int edge = neighbours.edges[k];
+                if (backward[edge]) continue;
+                sum += rank[drivers ? circuit.edges[edge].fromNode : circuit.edges[edge].toNode];
+                count++;
+            }
+            key[node] = count > 0 ? sum / count : rank[node];
+        }
+        std::stable_sort(columnNodes.begin() + begin, columnNodes.begin() + end,
+            [&key](int a, int b) { return key[a] < key[b]; });
+        setRanks(column);
+    };
+    for (int round = 0; round < BARYCENTER_ROUNDS; round++) {
+        for (int c = 1; c < columnCount; c++) {
+            sortColumn(c, in, true);
+        }
+        for (int c = columnCount - 2; c >= 0; c--) {
+            sortColumn(c, out, false);
+        }
+    }
+
+    // Stack each column in that order, each node as level with the centre of its drivers
+    // as the order allows. Packed tight from the top, node i would have to move down by
+    // (driver centre - packed centre), and no node may move less than the one above it,
+    // so the least-squares shifts are those targets averaged over runs that would
+    // otherwise cross (pool adjacent violators, linear per column)
+    float columnGap = COLUMN_GAP_CELLS * gridSize, rowGap = ROW_GAP_CELLS * gridSize;
+    std::vector<float> centerY(nodeCount, 0.0f);
+    std::vector<float> packed;
+    struct Pool { double sum; int count; };
+    std::vector<Pool> pools;
+    float columnX = 0;
+    for (int c = 0; c < columnCount; c++) {
+        int begin = columnStart[c], size = columnStart[c + 1] - begin;
+        float columnWidth = 0, top = 0;
+        packed.resize(size);
+        pools.clear();
+        for (int i = 0; i < size; i++) {
+            int node = columnNodes[begin + i];
+            NodeExtent extent = (node < (int)extents.size()) ? extents[node] : NodeExtent();
+            packed[i] = top;
+            top = SnapUpToGrid(top + extent.height + rowGap, gridSize);
+            columnWidth = std::max(columnWidth, extent.width);
+
+            // Nodes without drivers want to stay packed
+            double sum = 0;
+            int count = 0;
+            for (int k = in.start[node]; k < in.start[node + 1]; k++) {
+                int edge = in.edges[k];
+                if (backward[edge]) continue;
+                sum += centerY[circuit.edges[edge].fromNode];
+                count++;
+            }
+            double target = (count > 0) ? sum / count - (packed[i] + extent.height / 2) : 0.0;
+            pools.push_back({ target, 1 });
+            while (pools.size() > 1) {
+                const Pool& last = pools.back();
+                Pool& before = pools[pools.size() - 2];
+                if (before.sum * last.count <= last.sum * before.count) break;
+                before.sum += last.sum;
+                before.count += last.count;
+                pools.pop_back();
+            }
+        }
+
+        int i = 0;
+        for (const Pool& pool : pools) {
+            float shift = SnapToGrid((float)(pool.sum / pool.count), gridSize);
+            for (int end = i + pool.count; i < end; i++) {
+                int node = columnNodes[begin + i];
+                NodeExtent extent = (node < (int)extents.size()) ? extents[node] : NodeExtent();
+                positions[node].x = columnX;
+                positions[node].y = packed[i] + shift;
+                centerY[node] = positions[node].y + extent.height / 2;
+            }
+        }
+        columnX = SnapUpToGrid(columnX + columnWidth + columnGap, gridSize);
+    }
+    return positions;
+}
@@ -0,0 +1,35 @@
+#ifndef AUTO_PLACE_H
+#define AUTO_PLACE_H
+
+#include "Netlist.h"
+#include "CircuitFile.h"
+#include <vector>
+
+// ================================
+// LAYERED AUTO-PLACEMENT (no raylib dependency)
+// ================================
+
+// Size of a node's gate on the canvas
+struct NodeExtent {
+    float width = 0;
+    float height = 0;
+};
+
+// Lay a netlist out left to right in columns by logic level, for designs that
+// arrive without positions. Each node goes one column right of its latest
+// driver; OUTPUT nodes share a last column. Feedback (through flip-flops or
+// not) is broken where a depth-first search first closes the loop, and those
+// wires simply run backwards.
+//
+// Within each column, nodes are ordered to cut wire crossings with the
+// barycenter heuristic: a few sweeps right and back, each sorting a column by
+// the mean rank of its nodes' drivers (or, sweeping back, loads). Nodes are
+// then stacked in that order, as level with their drivers as the order allows
+// (least squares, in linear time). Every corner lands on a multiple of gridSize.
+//
+// extents[n] is node n's gate size; the result is each node's top-left corner.
+// Costs O((nodes + edges) log nodes).
+std::vector<NodePosition> PlaceLayered(const CircuitDescription& circuit, const std::vector<NodeExtent>& extents,
+    float gridSize);
+
+#endif // AUTO_PLACE_H
@@ -0,0 +1,161 @@
+#include "CanvasCache.h"
+#include "Constants.h"
+#include "rlgl.h"
+#include <cmath>
+#include <algorithm>
+
+// ================================
+// CANVAS CACHE IMPLEMENTATION
+// ================================
+
+// Draw into a transparent render texture keeping premultiplied alpha,
+// so the layer composites onto the screen without dark fringes
+static void BeginLayerBlend() {
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+}
+
+static bool SameCamera(const Camera2D& a, const Camera2D& b) {
+    return a.offset.x == b.offset.x && a.offset.y == b.offset.y &&
+        a.target.x == b.target.x && a.target.y == b.target.y &&
+        a.rotation == b.rotation && a.zoom == b.zoom;
+}
+
+// Refresh the scene layer
+void CanvasCache::Update(SceneRenderer& renderer, const GateStore& gates,
+    WiringSystem& wiring, GateHandle liveGate, const Viewport& viewport) {
+    if (sceneLayer.id == 0) {
+        sceneLayer = LoadRenderTexture(SCREEN_WIDTH, SCREEN_HEIGHT);
+        sceneValid = false;
+    }
+
+    bool layoutChanged = renderer.Update(gates, wiring, liveGate);
+    Rectangle changed;
+    bool signalsChanged = wiring.TakeChangedRegion(changed);
+
+    Rectangle view = viewport.GetVisibleWorldRect();
+    bool cameraChanged = !SameCamera(sceneCamera, viewport.GetCamera()) || sceneDetail != viewport.GetDetailLevel();
+
+    if (!sceneValid || layoutChanged || cameraChanged) {
+        RedrawScene(renderer, gates, viewport, view, false);
+        sceneValid = true;
+        sceneCamera = viewport.GetCamera();
+        sceneDetail = viewport.GetDetailLevel();
+    }
+    else if (signalsChanged && CheckCollisionRecs(changed, view)) {
+        Rectangle region = GetCollisionRec(changed, view);
+        RedrawScene(renderer, gates, viewport, region, true);
+    }
+}
+
+// Redraw all of the scene layer, or only the part covering worldRegion
+void CanvasCache::RedrawScene(SceneRenderer& renderer, const GateStore& gates,
+    const Viewport& viewport, Rectangle worldRegion, bool partial) {
+    BeginTextureMode(sceneLayer);
+
+    if (partial) {
+        // Scissor to the screen pixels covering the region; clearing respects the scissor
+        Vector2 topLeft = viewport.WorldToScreen({ worldRegion.x, worldRegion.y });
+        Vector2 bottomRight = viewport.WorldToScreen({ worldRegion.x + worldRegion.width, worldRegion.y + worldRegion.height });
+        int x = (int)std::floor(topLeft.x), y = (int)std::floor(topLeft.y);
+        int width = (int)std::ceil(bottomRight.x) - x, height = (int)std::ceil(bottomRight.y) - y;
+        BeginScissorMode(x, y, width, height);
+    }
+
+    ClearBackground(BLANK);
+    BeginLayerBlend();
+    BeginMode2D(viewport.GetCamera());
+    renderer.DrawCached(gates, worldRegion, viewport.GetDetailLevel());
+    EndMode2D();
+    EndBlendMode();
+
+    if (partial) EndScissorMode();
+    EndTextureMode();
+}
+
+// Render one major grid cell at the current zoom into a repeating texture
+void CanvasCache::RebuildGridTexture(float zoom) {
+    if (gridTexture.id != 0) UnloadRenderTexture(gridTexture);
+
+    float majorPixels = GRID_SIZE * GRID_MAJOR_EVERY * zoom;
+    int size = std::min(2048, std::max(1, (int)std::ceil(majorPixels)));
+    gridTexture = LoadRenderTexture(size, size);
+    SetTextureWrap(gridTexture.texture, TEXTURE_WRAP_REPEAT);
+
+    BeginTextureMode(gridTexture);
+    ClearBackground(BLANK);
+    BeginLayerBlend();
+
+    // Minor lines, if they are not too dense to read
+    if (GRID_SIZE * zoom >= GRID_MIN_SPACING_PIXELS) {
+        Color minorColor = ColorAlpha(GRAY, 0.3f);
+        for (int i = 1; i < GRID_MAJOR_EVERY; i++) {
+            int offset = (int)std::round(i * size / (float)GRID_MAJOR_EVERY);
+            DrawRectangle(offset, 0, 1, size, minorColor);
+            DrawRectangle(0, offset, size, 1, minorColor);
+        }
+    }
+
+    // Major lines along the cell's top and left edges
+    Color majorColor = ColorAlpha(DARKGRAY, 0.5f);
+    DrawRectangle(0, 0, 1, size, majorColor);
+    DrawRectangle(1, 0, size - 1, 1, majorColor);
+
+    EndBlendMode();
+    EndTextureMode();
+    gridZoom = zoom;
+}
+
+// Composite the grid onto the canvas with one repeating quad
+void CanvasCache::DrawGrid(const Viewport& viewport) {
+    float zoom = viewport.GetZoom();
+    float majorPixels = GRID_SIZE * GRID_MAJOR_EVERY * zoom;
+    if (majorPixels < GRID_MIN_SPACING_PIXELS) return;
+    if (zoom != gridZoom || gridTexture.id == 0) RebuildGridTexture(zoom);
+
+    Rectangle view = viewport.GetVisibleWorldRect();
+    float cellWorld = (float)(GRID_SIZE * GRID_MAJOR_EVERY);
+    float size = (float)gridTexture.texture.width;
+    float texelsPerPixel = size / majorPixels;
+
+    // Where the top-left of the canvas falls inside a grid cell, in texels
+    float u = std::fmod(view.x, cellWorld);
+    float v = std::fmod(view.y, cellWorld);
+    if (u < 0) u += cellWorld;
+    if (v < 0) v += cellWorld;
+    u = u / cellWorld * size;
+    v = v / cellWorld * size;
+
+    float canvasWidth = (float)(SCREEN_WIDTH - SIDEBAR_WIDTH);
+    float canvasHeight = (float)SCREEN_HEIGHT;
+    float sourceWidth = canvasWidth * texelsPerPixel;
+    float sourceHeight = canvasHeight * texelsPerPixel;
+
+    // Render textures are stored upside down: flip with a negative height
+    Rectangle source = { u, -(v + sourceHeight), sourceWidth, -sourceHeight };
+    Rectangle dest = { (float)SIDEBAR_WIDTH, 0, canvasWidth, canvasHeight };
+
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTexturePro(gridTexture.texture, source, dest, { 0, 0 }, 0.0f, WHITE);
+    EndBlendMode();
+}
+
+// Composite the cached gates and wires
+void CanvasCache::DrawScene() const {
+    if (sceneLayer.id == 0) return;
+
+    Rectangle source = { 0, 0, (float)sceneLayer.texture.width, -(float)sceneLayer.texture.height };
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTextureRec(sceneLayer.texture, source, { 0, 0 }, WHITE);
+    EndBlendMode();
+}
+
+// Release render textures (before the window closes)
+void CanvasCache::Unload() {
+    if (gridTexture.id != 0) UnloadRenderTexture(gridTexture);
+    if (sceneLayer.id != 0) UnloadRenderTexture(sceneLayer);
+    gridTexture = { 0 };
+    sceneLayer = { 0 };
+    gridZoom = -1.0f;
+    sceneValid = false;
+}
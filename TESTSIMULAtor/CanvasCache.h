@@ -0,0 +1,54 @@
+#ifndef CANVAS_CACHE_H
+#define CANVAS_CACHE_H
+
+#include "raylib.h"
+#include "Gate.h"
+#include "WiringSystem.h"
+#include "SceneRenderer.h"
+#include "Viewport.h"
+#include <vector>
+#include <memory>
+
+// ================================
+// CANVAS CACHE DECLARATION
+// ================================
+
+// Render-texture caches for the canvas.
+// - The grid is one major grid cell rendered into a small repeating texture
+//   and stretched over the canvas with a single quad; it is re-rendered only
+//   when the zoom changes.
+// - Placed gates and wires are composited from a screen-sized layer. The layer
+//   is fully redrawn when the camera or the layout changes; when only signals
+//   change, just the region around the affected wires and gates is cleared and
+//   redrawn. Dragged gates, previews and highlights are drawn live on top.
+class CanvasCache {
+private:
+    RenderTexture2D gridTexture = { 0 };
+    float gridZoom = -1.0f;
+
+    RenderTexture2D sceneLayer = { 0 };
+    bool sceneValid = false;
+    Camera2D sceneCamera = { { 0, 0 }, { 0, 0 }, 0.0f, 1.0f };
+    DetailLevel sceneDetail = DetailLevel::FULL;
+
+    void RebuildGridTexture(float zoom);
+    void RedrawScene(SceneRenderer& renderer, const GateStore& gates,
+        const Viewport& viewport, Rectangle worldRegion, bool partial);
+
+public:
+    // Force a full redraw of the scene layer
+    void Invalidate() { sceneValid = false; }
+
+    // Refresh the scene layer (call before BeginDrawing)
+    void Update(SceneRenderer& renderer, const GateStore& gates,
+        WiringSystem& wiring, GateHandle liveGate, const Viewport& viewport);
+
+    // Composite the cached layers onto the screen (canvas area only)
+    void DrawGrid(const Viewport& viewport);
+    void DrawScene() const;
+
+    // Release render textures (before the window closes)
+    void Unload();
+};
+
+#endif // CANVAS_CACHE_H
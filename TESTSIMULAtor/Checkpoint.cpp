@@ -0,0 +1,122 @@
+#include "Checkpoint.h"
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+// ================================
+// CHECKPOINT IMPLEMENTATION
+// ================================
+
+static const char CHECKPOINT_MAGIC[8] = { 'L', 'S', 'I', 'M', 'C', 'K', 'P', 'T' };
+static const uint32_t CHECKPOINT_VERSION = 2;     // 2: nets may be numbered in evaluation order
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+// Fixed-size fields only, so the header is the same wherever it was written
+struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;         // BYTE_ORDER_MARK as written by the saving machine
+    uint32_t wordBytes;         // sizeof(BusWord)
+    uint32_t reserved;
+    uint64_t fingerprint;
+    uint64_t tick;
+    uint64_t netCount;
+};
+
+// FNV-1a over the integers that lay out the nets
+unsigned long long CircuitFingerprint(const CompiledCircuit& circuit) {
+    unsigned long long hash = 14695981039346656037ULL;
+    auto mix = [&hash](unsigned long long value) {
+        for (int byte = 0; byte < 8; byte++) {
+            hash ^= (value >> (byte * 8)) & 0xFF;
+            hash *= 1099511628211ULL;
+        }
+    };
+    auto mixAll = [&mix](const std::vector<int>& values) {
+        mix(values.size());
+        for (int value : values) mix((unsigned long long)(long long)value);
+    };
+
+    auto mixOps = [&mix](const std::vector<CompiledOp>& ops) {
+        mix(ops.size());
+        for (const CompiledOp& op : ops) {
+            mix((unsigned long long)op.type);
+            mix((unsigned long long)(long long)op.definition);
+            mix((unsigned long long)op.inputCount);
+            mix((unsigned long long)op.outputCount);
+            mix(op.mask);
+        }
+    };
+
+    mix((unsigned long long)circuit.netCount);
+    mixOps(circuit.ops);
+    mixOps(circuit.stateOps);
+    mixAll(circuit.pins);
+    mixAll(circuit.inputNets);
+    mixAll(circuit.outputNets);
+    mixAll(circuit.inputWidths);
+    mixAll(circuit.outputWidths);
+    return hash;
+}
+
+bool SaveCheckpoint(const std::string& path, const CompiledCircuit& circuit, unsigned long long tick,
+    const std::vector<BusWord>& nets, std::string* error) {
+    auto fail = [error](const std::string& message) {
+        if (error) *error = message;
+        return false;
+    };
+    if ((int)nets.size() < circuit.netCount) return fail("no state to save");
+
+    CheckpointHeader header = {};
+    std::memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.version = CHECKPOINT_VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.wordBytes = sizeof(BusWord);
+    header.fingerprint = CircuitFingerprint(circuit);
+    header.tick = tick;
+    header.netCount = (uint64_t)circuit.netCount;
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return fail("cannot write " + path);
+    bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+        std::fwrite(nets.data(), sizeof(BusWord), (size_t)circuit.netCount, file) == (size_t)circuit.netCount;
+    if (std::fclose(file) != 0 || !written) return fail("cannot write " + path);
+    return true;
+}
+
+bool LoadCheckpoint(const std::string& path, const CompiledCircuit& circuit, unsigned long long& tick,
+    std::vector<BusWord>& nets, std::string* error) {
+    auto fail = [error](const std::string& message) {
+        if (error) *error = message;
+        return false;
+    };
+
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return fail("cannot open " + path);
+
+    CheckpointHeader header;
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1 &&
+        std::memcmp(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic)) == 0;
+    if (!ok) {
+        std::fclose(file);
+        return fail("not a checkpoint");
+    }
+    if (header.version != CHECKPOINT_VERSION || header.byteOrder != BYTE_ORDER_MARK || header.wordBytes != sizeof(BusWord)) {
+        std::fclose(file);
+        return fail("checkpoint from an incompatible build");
+    }
+    if (header.fingerprint != CircuitFingerprint(circuit) || header.netCount != (uint64_t)circuit.netCount) {
+        std::fclose(file);
+        return fail("checkpoint is of a different circuit");
+    }
+
+    std::vector<BusWord> loaded(circuit.scratchNets, 0);
+    ok = std::fread(loaded.data(), sizeof(BusWord), (size_t)circuit.netCount, file) == (size_t)circuit.netCount;
+    std::fclose(file);
+    if (!ok) return fail("checkpoint is truncated");
+
+    loaded[0] = 0;   // Net 0 is the constant low
+    nets.swap(loaded);
+    tick = header.tick;
+    return true;
+}
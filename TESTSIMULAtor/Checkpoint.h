@@ -0,0 +1,34 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "Netlist.h"
+#include <string>
+#include <vector>
+
+// ================================
+// SIMULATION CHECKPOINTS (no raylib dependency)
+// ================================
+
+// The whole state of a running simulation is the top-level net array: every
+// INPUT value, gate output and feedback loop lives there, and nested
+// subcircuits are recomputed from it each pass. A checkpoint is a fixed header
+// followed by that array as raw words, so saving is one bulk write and
+// restoring one bulk read into the nets of the already compiled circuit.
+//
+// Checkpoints use the machine's own byte order and are tied to the exact
+// compiled layout (see CircuitFingerprint); they are for resuming or branching
+// runs, not for exchanging designs - use circuit files for that.
+
+// Hash of everything that decides which value lives in which net
+unsigned long long CircuitFingerprint(const CompiledCircuit& circuit);
+
+// Write nets[0 .. netCount) and the tick they were taken at
+bool SaveCheckpoint(const std::string& path, const CompiledCircuit& circuit, unsigned long long tick,
+    const std::vector<BusWord>& nets, std::string* error = nullptr);
+
+// Read a checkpoint taken of this circuit; nets is resized to scratchNets so it
+// can be stepped straight away. False (nets untouched) if it belongs to another layout.
+bool LoadCheckpoint(const std::string& path, const CompiledCircuit& circuit, unsigned long long& tick,
+    std::vector<BusWord>& nets, std::string* error = nullptr);
+
+#endif // CHECKPOINT_H
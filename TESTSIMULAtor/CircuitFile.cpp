@@ -0,0 +1,228 @@
+#include "CircuitFile.h"
+#include <fstream>
+#include <sstream>
+
+// ================================
+// CIRCUIT FILE IMPLEMENTATION
+// ================================
+
+static const char* const FILE_MAGIC = "LOGICSIM";
+static const int FILE_VERSION = 1;
+
+static const GateType ALL_GATE_TYPES[] = {
+    GateType::INPUT, GateType::OUTPUT, GateType::AND, GateType::OR,
+    GateType::NOT, GateType::NAND, GateType::NOR, GateType::SUBCIRCUIT,
+    GateType::CLOCK, GateType::DFF, GateType::REGISTER
+};
+
+const char* GateTypeName(GateType type) {
+    switch (type) {
+    case GateType::INPUT:      return "INPUT";
+    case GateType::OUTPUT:     return "OUTPUT";
+    case GateType::AND:        return "AND";
+    case GateType::OR:         return "OR";
+    case GateType::NOT:        return "NOT";
+    case GateType::NAND:       return "NAND";
+    case GateType::NOR:        return "NOR";
+    case GateType::SUBCIRCUIT: return "SUBCIRCUIT";
+    case GateType::CLOCK:      return "CLOCK";
+    case GateType::DFF:        return "DFF";
+    case GateType::REGISTER:   return "REGISTER";
+    default:                   return "UNKNOWN";
+    }
+}
+
+bool ParseGateType(const std::string& name, GateType& type) {
+    for (GateType candidate : ALL_GATE_TYPES) {
+        if (name == GateTypeName(candidate)) {
+            type = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Write one description; positions only for the canvas
+static void WriteDescription(std::ostream& out, const char* keyword, const CircuitDescription& description,
+    const std::vector<NodePosition>* positions) {
+    out << keyword << " " << description.name << "\n";
+    for (size_t n = 0; n < description.nodes.size(); n++) {
+        const NetlistNode& node = description.nodes[n];
+        out << "node " << GateTypeName(node.type) << " " << node.width << " " << node.definition;
+        if (positions) {
+            NodePosition position = (n < positions->size()) ? (*positions)[n] : NodePosition();
+            out << " " << position.x << " " << position.y;
+        }
+        out << "\n";
+    }
+    for (const NetlistEdge& edge : description.edges) {
+        out << "edge " << edge.fromNode << " " << edge.fromPort << " " << edge.toNode << " " << edge.toPort << "\n";
+    }
+    out << "end\n";
+}
+
+bool SaveCircuitFile(const std::string& path, const CircuitFile& file) {
+    std::ofstream out(path);
+    if (!out) return false;
+
+    out << FILE_MAGIC << " " << FILE_VERSION << "\n";
+    for (const CircuitDescription& block : file.blocks) {
+        WriteDescription(out, "block", block, nullptr);
+    }
+    WriteDescription(out, "circuit", file.circuit, &file.positions);
+    return (bool)out;
+}
+
+bool LoadCircuitFile(const std::string& path, CircuitFile& file, std::string* error) {
+    auto fail = [error](int lineNumber, const std::string& message) {
+        if (error) *error = (lineNumber > 0 ? "line " + std::to_string(lineNumber) + ": " : std::string()) + message;
+        return false;
+    };
+
+    std::ifstream in(path);
+    if (!in) return fail(0, "cannot open " + path);
+
+    file = CircuitFile();
+    CircuitDescription* current = nullptr;   // Description being read, if inside block/circuit
+    bool inCircuit = false;
+    bool haveCircuit = false;
+    bool haveHeader = false;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+
+        std::istringstream fields(line);
+        std::string keyword;
+        if (!(fields >> keyword)) continue;
+
+        if (!haveHeader) {
+            int version = 0;
+            if (keyword != FILE_MAGIC || !(fields >> version)) return fail(lineNumber, "not a circuit file");
+            if (version != FILE_VERSION) return fail(lineNumber, "unsupported version " + std::to_string(version));
+            haveHeader = true;
+        }
+        else if (keyword == "block" || keyword == "circuit") {
+            if (current) return fail(lineNumber, "missing 'end'");
+            if (haveCircuit) return fail(lineNumber, "nothing may follow the circuit");
+            inCircuit = (keyword == "circuit");
+            if (inCircuit) {
+                current = &file.circuit;
+                haveCircuit = true;
+            }
+            else {
+                file.blocks.push_back(CircuitDescription());
+                current = &file.blocks.back();
+            }
+            std::getline(fields >> std::ws, current->name);
+        }
+        else if (keyword == "node" && current) {
+            std::string typeName;
+            NetlistNode node;
+            if (!(fields >> typeName >> node.width >> node.definition) || !ParseGateType(typeName, node.type)) {
+                return fail(lineNumber, "bad node");
+            }
+
+            // Blocks may only use blocks defined before them
+            int usable = inCircuit ? (int)file.blocks.size() : (int)file.blocks.size() - 1;
+            if (node.type == GateType::SUBCIRCUIT && (node.definition < 0 || node.definition >= usable)) {
+                return fail(lineNumber, "unknown block " + std::to_string(node.definition));
+            }
+            if (node.width < 1 || node.width > MAX_BUS_WIDTH) return fail(lineNumber, "bad width");
+            if (!inCircuit && IsClocked(node.type)) return fail(lineNumber, "blocks can't hold clocked gates");
+            current->nodes.push_back(node);
+
+            if (inCircuit) {
+                NodePosition position;
+                if (!(fields >> position.x >> position.y)) file.positioned = false;
+                file.positions.push_back(position);
+            }
+        }
+        else if (keyword == "edge" && current) {
+            NetlistEdge edge;
+            if (!(fields >> edge.fromNode >> edge.fromPort >> edge.toNode >> edge.toPort)) return fail(lineNumber, "bad edge");
+            current->edges.push_back(edge);
+        }
+        else if (keyword == "end" && current) {
+            current = nullptr;
+        }
+        else {
+            return fail(lineNumber, "unexpected '" + keyword + "'");
+        }
+    }
+
+    if (!haveHeader) return fail(0, "empty file");
+    if (current) return fail(lineNumber, "missing 'end'");
+    if (!haveCircuit) return fail(lineNumber, "no circuit");
+    return true;
+}
+
+bool LinkCircuitFile(CircuitFile& file, SubcircuitLibrary& library) {
+    std::vector<int> ids;
+    auto relink = [&ids](CircuitDescription& description) {
+        for (NetlistNode& node : description.nodes) {
+            if (node.type == GateType::SUBCIRCUIT) node.definition = ids[node.definition];
+        }
+    };
+
+    // Work out every block's id first, reused or next free, so nothing is added
+    // unless all of it fits
+    std::vector<CircuitDescription> blocks = file.blocks;
+    std::vector<size_t> added;     // Blocks new to the library, in the order they'll be added
+    for (CircuitDescription& block : blocks) {
+        relink(block);
+        int id = library.Find(block);
+        if (id < 0) {
+            id = library.Count() + (int)added.size();
+            added.push_back(ids.size());
+        }
+        ids.push_back(id);
+    }
+    if (library.Count() + (int)added.size() > MAX_SUBCIRCUITS) return false;
+
+    for (size_t b : added) {
+        if (library.Add(blocks[b]) != ids[b]) return false;
+    }
+    file.blocks = std::move(blocks);
+    relink(file.circuit);
+    return true;
+}
+
+void GatherCircuitBlocks(CircuitFile& file, const SubcircuitLibrary& library) {
+    // Definitions only use earlier ones, so one pass down from the top finds every
+    // block in use
+    int count = library.Count();
+    std::vector<char> used(count, 0);
+    auto markUses = [&used, count](const CircuitDescription& description) {
+        for (const NetlistNode& node : description.nodes) {
+            if (node.type == GateType::SUBCIRCUIT && node.definition >= 0 && node.definition < count) {
+                used[node.definition] = 1;
+            }
+        }
+    };
+    markUses(file.circuit);
+    for (int id = count - 1; id >= 0; id--) {
+        if (used[id]) markUses(*library.GetDescription(id));
+    }
+
+    // Write them out in library order, so each block still comes after the ones it uses
+    std::vector<int> blockOf(count, -1);
+    auto renumber = [&blockOf, count](CircuitDescription& description) {
+        for (NetlistNode& node : description.nodes) {
+            if (node.type == GateType::SUBCIRCUIT && node.definition >= 0 && node.definition < count) {
+                node.definition = blockOf[node.definition];
+            }
+        }
+    };
+    file.blocks.clear();
+    for (int id = 0; id < count; id++) {
+        if (!used[id]) continue;
+        blockOf[id] = (int)file.blocks.size();
+        file.blocks.push_back(*library.GetDescription(id));
+        renumber(file.blocks.back());
+    }
+    renumber(file.circuit);
+}
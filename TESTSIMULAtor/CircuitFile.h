@@ -0,0 +1,58 @@
+#ifndef CIRCUIT_FILE_H
+#define CIRCUIT_FILE_H
+
+#include "Netlist.h"
+#include <string>
+#include <vector>
+
+// ================================
+// CIRCUIT FILES (no raylib dependency)
+// ================================
+
+// A saved design: the subcircuit blocks it uses and the canvas itself. Read by
+// the editor (Ctrl+O) and by the headless batch runner (tools/simbatch.cpp).
+//
+// Text format, one record per line ('#' starts a comment):
+//   LOGICSIM 1
+//   block <name>                      one per subcircuit definition, in order
+//   node <TYPE> <width> <block>       TYPE as in GateTypeName; block is -1 or
+//   edge <from> <fromPort> <to> <toPort>   the index of an earlier block
+//   end
+//   circuit <name>                    the canvas; its nodes also carry x y
+//   node <TYPE> <width> <block> <x> <y>
+//   edge ...
+//   end
+// Generated netlists may leave out x y; the editor then lays the circuit out
+// itself (see PlaceLayered).
+struct NodePosition {
+    float x = 0;
+    float y = 0;
+};
+
+struct CircuitFile {
+    std::vector<CircuitDescription> blocks;   // SUBCIRCUIT nodes refer to blocks by index
+    CircuitDescription circuit;
+    std::vector<NodePosition> positions;      // Canvas position of each circuit node
+    bool positioned = true;                   // False if any circuit node came without x y
+};
+
+// Name used for a gate type in files and reports, and the reverse (false if unknown)
+const char* GateTypeName(GateType type);
+bool ParseGateType(const std::string& name, GateType& type);
+
+bool SaveCircuitFile(const std::string& path, const CircuitFile& file);
+bool LoadCircuitFile(const std::string& path, CircuitFile& file, std::string* error = nullptr);
+
+// Add a loaded file's blocks to a library and point every SUBCIRCUIT node
+// (in later blocks and in the circuit) at the ids they got. A block the
+// library already holds is reused, so loading the same file again adds
+// nothing. All or nothing: false, with the library and file untouched, if
+// the new blocks don't fit.
+bool LinkCircuitFile(CircuitFile& file, SubcircuitLibrary& library);
+
+// The reverse, for saving: fill file.blocks with the library definitions that
+// file.circuit uses, directly or through other blocks, and point its
+// SUBCIRCUIT nodes (library ids until now) at their block indices.
+void GatherCircuitBlocks(CircuitFile& file, const SubcircuitLibrary& library);
+
+#endif // CIRCUIT_FILE_H
@@ -1,12 +1,23 @@
 #include "Constants.h"
+#include "GateAtlasData.h"
 
 // Define the actual GATE_DATA map
 std::map<GateType, GateInfo> GATE_DATA = {
-    {GateType::INPUT,  {{60, 40}, LIGHTGRAY, "INP", nullptr, {0}}},
-    {GateType::OUTPUT, {{60, 40}, SKYBLUE,   "OUT", nullptr, {0}}},
-    {GateType::AND,    {{75, 50}, DARKGREEN, "AND", "resources/and_gate.png", {0}}},
-    {GateType::OR,     {{75, 50}, DARKBLUE,  "OR",  "resources/or_gate.png", {0}}},
-    {GateType::NOT,    {{75, 50}, MAROON,    "NOT", "resources/not_gate.png", {0}}},
-    {GateType::NAND,   {{75, 50}, LIME,      "NAND","resources/nand_gate.png", {0}}},
-    {GateType::NOR,    {{75, 50}, PURPLE,    "NOR", "resources/nor_gate.png", {0}}}
-};
\ No newline at end of file
+    {GateType::INPUT,  {{60, 40}, LIGHTGRAY, "INP", {0}, {0, 0, 0, 0}}},
+    {GateType::OUTPUT, {{60, 40}, SKYBLUE,   "OUT", {0}, {0, 0, 0, 0}}},
+    {GateType::AND,    {{75, 50}, DARKGREEN, "AND", {0}, GATE_ATLAS_RECT_AND}},
+    {GateType::OR,     {{75, 50}, DARKBLUE,  "OR",  {0}, GATE_ATLAS_RECT_OR}},
+    {GateType::NOT,    {{75, 50}, MAROON,    "NOT", {0}, GATE_ATLAS_RECT_NOT}},
+    {GateType::NAND,   {{75, 50}, LIME,      "NAND",{0}, GATE_ATLAS_RECT_NAND}},
+    {GateType::NOR,    {{75, 50}, PURPLE,    "NOR", {0}, GATE_ATLAS_RECT_NOR}},
+    {GateType::SUBCIRCUIT, {{SUBCIRCUIT_WIDTH, 60}, BROWN, "SUB", {0}, {0, 0, 0, 0}}},
+    {GateType::CLOCK,  {{60, 40}, ORANGE,    "CLK", {0}, {0, 0, 0, 0}}},
+    {GateType::DFF,    {{75, 50}, GOLD,      "DFF", {0}, {0, 0, 0, 0}}},
+    {GateType::REGISTER, {{75, 50}, BEIGE,   "REG", {0}, {0, 0, 0, 0}}}
+};
+
+// Atlas and sprite locations; the digits are sized by LoadGateTextures
+Texture2D GATE_ATLAS = { 0 };
+Rectangle ATLAS_WHITE_RECT = GATE_ATLAS_RECT_WHITE;
+Rectangle ATLAS_DISC_RECT = GATE_ATLAS_RECT_DISC;
+Rectangle ATLAS_DIGIT_RECTS[2] = { GATE_ATLAS_RECT_DIGIT_SLOT_0, GATE_ATLAS_RECT_DIGIT_SLOT_1 };
\ No newline at end of file
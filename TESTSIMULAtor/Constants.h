@@ -2,7 +2,11 @@
 #define CONSTANTS_H
 
 #include "raylib.h"
+#include "SlotMap.h"
+#include "SmallVector.h"
+#include "GateLogic.h"
 #include <map>
+#include <memory>
 
 // CONSTANTS AND CONFIGURATION
 // ================================
@@ -15,13 +19,71 @@ const float CONNECTION_SNAP_DISTANCE = 15.0f;
 // Grid system for visual aid and alignment
 const int GRID_SIZE = 30;
 const bool SHOW_GRID_DEFAULT = true;
+const int GRID_MAJOR_EVERY = 5;                // Thicker line every 5 grid units (like Proteus)
+const float GRID_MIN_SPACING_PIXELS = 6.0f;    // Hide grid lines packed closer than this on screen
+
+// Canvas camera: zoom limits, wheel step, and the zoom below which
+// gates and wires are drawn as plain shapes
+const float CAMERA_MIN_ZOOM = 0.05f;
+const float CAMERA_MAX_ZOOM = 4.0f;
+const float CAMERA_ZOOM_STEP = 1.125f;
+const float LOD_SIMPLE_ZOOM = 0.45f;
+
+// Size of the world tiles the renderer caches and culls independently
+const float RENDER_TILE_SIZE = 1024.0f;
+
+// Background wire routing while dragging gates
+const int ROUTE_DEBOUNCE_MS = 30;
+
+// Bulk routing: obstacle grid cell size, wires per thread before going parallel,
+// and spacing between parallel wire jogs that would otherwise overlap
+const float OBSTACLE_CELL_SIZE = GRID_SIZE * 4.0f;
+const int PARALLEL_ROUTE_MIN_WIRES = 256;
+const float ROUTE_LANE_SPACING = 6.0f;
+
+// Undo/redo: oldest edits are dropped past this many
+const int UNDO_HISTORY_LIMIT = 1000;
+
+// Threaded simulation: tick rates cycled with - and = (0 runs as fast as possible)
+const double SIMULATION_TICK_RATES[] = { 1, 10, 60, 1000, 100000, 0 };
+const int SIMULATION_TICK_RATE_COUNT = 6;
+const int SIMULATION_DEFAULT_TICK_RATE = 3;
+
+// Design saved with Ctrl+S and loaded with Ctrl+O (see CircuitFile.h)
+const char* const CIRCUIT_FILE_PATH = "circuit.lsim";
+
+// Simulation state saved with F5 and restored with F9 (see Checkpoint.h)
+const char* const CHECKPOINT_FILE_PATH = "circuit.ckpt";
+
+// Wire strokes; buses are drawn heavier so they read apart from single bits
+const float WIRE_THICKNESS = 4.0f;
+const float BUS_WIRE_THICKNESS = 7.0f;
+
+// Toggle heatmap (H key): wire colours step through this many activity levels,
+// spread logarithmically from HEATMAP_MIN_ACTIVITY to toggling every tick
+const int HEATMAP_LEVELS = 8;
+const double HEATMAP_MIN_ACTIVITY = 1e-6;
+
+// Four-valued simulation (X key): nets and pins that are unknown (X) or floating (Z)
+const Color UNKNOWN_SIGNAL_COLOR = VIOLET;
+const Color FLOATING_SIGNAL_COLOR = SKYBLUE;
+
+// Rectangle selection (drag on empty canvas) and Ctrl+D replication: most copies
+// in one go, stepped through with , and .
+const Color SELECTION_COLOR = BLUE;
+const int MAX_REPLICATE_COPIES = 1024;
+
+// Toggle coverage report written with F6 (see Coverage.h)
+const char* const COVERAGE_REPORT_PATH = "coverage.txt";
+
+// Subcircuit blocks: body width and vertical distance between port pins
+const float SUBCIRCUIT_WIDTH = 90.0f;
+const float SUBCIRCUIT_PIN_SPACING = 20.0f;
 
 
 // ENUMS AND DATA STRUCTURES
 // ================================
-enum class GateType {
-    INPUT, OUTPUT, AND, OR, NOT, NAND, NOR
-};
+// GateType lives in GateLogic.h so the netlist code can use it without raylib
 
 enum class SimulatorMode {
     PLACEMENT, WIRING
@@ -31,27 +93,46 @@ struct GateInfo {
     Vector2 size;
     Color color;
     const char* label;
-    const char* imagePath;  // Path to image file
-    Texture2D texture;      // Texture will be loaded at runtime
+    Texture2D texture;      // GATE_ATLAS once loaded, if the gate has an image
+    Rectangle atlasRect;    // Where the image sits in GATE_ATLAS (zero if it has none)
 };
 
 // Lookup table for gate properties - DECLARATION ONLY
-// Note: INPUT and OUTPUT don't have images, all others use the provided paths
+// Note: INPUT and OUTPUT don't have images; the others come from GateAtlasData.h,
+// generated from resources/ by tools/pack_atlas.py
 extern std::map<GateType, GateInfo> GATE_DATA;
 
+// Texture atlas shared by all batched drawing: every gate image plus a few
+// sprites (solid white, anti-aliased disc, state digits) so gates, pins and
+// wires can all be submitted with one texture bound
+extern Texture2D GATE_ATLAS;
+extern Rectangle ATLAS_WHITE_RECT;
+extern Rectangle ATLAS_DISC_RECT;
+extern Rectangle ATLAS_DIGIT_RECTS[2];
+
 // CONNECTION POINT HELPER
 // ================================
 struct ConnectionPoint {
     Vector2 position;
     bool isInput;
-    int gateIndex;
-    int inputIndex;  // For input points: 0 or 1, for output: always 0
+    GateHandle gate;
+    int inputIndex;  // Input or output pin number (always 0 for single-output gates)
 
-    ConnectionPoint(Vector2 pos, bool input, int gate, int idx = 0)
-        : position(pos), isInput(input), gateIndex(gate), inputIndex(idx) {
+    ConnectionPoint(Vector2 pos, bool input, GateHandle gateHandle, int idx = 0)
+        : position(pos), isInput(input), gate(gateHandle), inputIndex(idx) {
     }
 };
 
+// Gate and wire storage: stable handles, O(1) insert and erase
+class Gate;
+class Wire;
+typedef SlotMap<std::unique_ptr<Gate>, GateHandle> GateStore;
+typedef SlotMap<std::unique_ptr<Wire>, WireHandle> WireStore;
+
+// A wire's route: start, at most two corners and end, stored inline so
+// rerouting never allocates
+typedef SmallVector<Vector2, 6> WaypointList;
+
 // Function declarations for texture management
 void LoadGateTextures();
 void UnloadGateTextures();
@@ -0,0 +1,67 @@
+#include "Coverage.h"
+#include "CircuitFile.h"
+#include <cstdio>
+#include <algorithm>
+
+// ================================
+// TOGGLE COVERAGE IMPLEMENTATION
+// ================================
+
+void ToggleCoverage::Reset(size_t netCount) {
+    previous.assign(netCount, 0);
+    toggles.assign(netCount, 0);
+    toggledLanes.assign(netCount, 0);
+    samples = 0;
+}
+
+void CountToggledBits(const CompiledCircuit& circuit, const ToggleCoverage& coverage,
+    size_t& toggledBits, size_t& totalBits) {
+    toggledBits = 0;
+    totalBits = 0;
+    size_t netCount = std::min(coverage.NetCount(), circuit.netWidths.size());
+    for (size_t n = 1; n < netCount; n++) {
+        BusWord mask = BusMask(circuit.netWidths[n]);
+        toggledBits += PopCount(coverage.ToggledLanes()[n] & mask);
+        totalBits += circuit.netWidths[n];
+    }
+}
+
+void WriteCoverageReport(std::ostream& out, const CircuitDescription& description,
+    const CompiledCircuit& circuit, const ToggleCoverage& coverage) {
+    size_t toggledBits = 0, totalBits = 0;
+    CountToggledBits(circuit, coverage, toggledBits, totalBits);
+    unsigned long long transitions = coverage.Transitions();
+
+    char line[160];
+    std::snprintf(line, sizeof(line), "# toggle coverage of %s over %llu transitions\n", circuit.name.c_str(), transitions);
+    out << line;
+    std::snprintf(line, sizeof(line), "# %zu of %zu net bits toggled (%.1f%%)\n", toggledBits, totalBits,
+        totalBits ? 100.0 * toggledBits / totalBits : 100.0);
+    out << line;
+    out << "# node type pin width toggles activity untested-lanes\n";
+
+    const size_t nodeCount = std::min(description.nodes.size(), circuit.nodeOutputNets.size());
+    for (size_t n = 0; n < nodeCount; n++) {
+        int firstNet = circuit.nodeOutputNets[n];
+        int endNet = (n + 1 < nodeCount) ? circuit.nodeOutputNets[n + 1] : circuit.netCount;
+        for (int net = firstNet; net < endNet && net < (int)coverage.NetCount(); net++) {
+            int width = circuit.netWidths[net];
+            BusWord untested = BusMask(width) & ~coverage.ToggledLanes()[net];
+            unsigned long long toggles = coverage.Toggles()[net];
+            std::snprintf(line, sizeof(line), "%zu %s %d %d %llu %.6f", n, GateTypeName(description.nodes[n].type),
+                net - firstNet, width, toggles, SwitchingActivity(toggles, transitions, width));
+            out << line;
+            if (untested) {
+                char hex[MAX_BUS_WIDTH / 4 + 1];
+                int digits = (width + 3) / 4;
+                for (int d = digits - 1; d >= 0; d--) {
+                    hex[d] = "0123456789ABCDEF"[untested & 15];
+                    untested >>= 4;
+                }
+                hex[digits] = '\0';
+                out << " " << hex << " UNTESTED";
+            }
+            out << "\n";
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef COVERAGE_H
+#define COVERAGE_H
+
+#include "Netlist.h"
+#include <ostream>
+#include <vector>
+
+// ================================
+// TOGGLE COVERAGE (no raylib dependency)
+// ================================
+
+// Counts how often every lane of every net changes between consecutive
+// samples of a circuit's nets. Each net is one word with its bus lanes packed
+// side by side, so a sample is one XOR and one popcount per net whatever the
+// bus width. Lanes that never toggle mark logic the stimulus never exercised,
+// and toggles per lane per tick is the switching activity used for power
+// estimates.
+class ToggleCoverage {
+private:
+    std::vector<BusWord> previous;
+    std::vector<unsigned long long> toggles;    // Lane toggles per net, summed over lanes
+    std::vector<BusWord> toggledLanes;          // Lanes of each net seen to change
+    unsigned long long samples = 0;
+
+public:
+    // Start over for a circuit with netCount nets; the next sample is only a baseline
+    void Reset(size_t netCount);
+
+    // Take nets[0 .. netCount) after a tick
+    void Sample(const BusWord* nets) {
+        if (samples++ == 0) {
+            previous.assign(nets, nets + previous.size());
+            return;
+        }
+        for (size_t n = 0; n < previous.size(); n++) {
+            BusWord changed = nets[n] ^ previous[n];
+            toggles[n] += PopCount(changed);
+            toggledLanes[n] |= changed;
+            previous[n] = nets[n];
+        }
+    }
+
+    // Take count samples all equal to nets, for ticks skipped because the circuit had settled
+    void Repeat(const BusWord* nets, unsigned long long count) {
+        if (count == 0) return;
+        Sample(nets);
+        samples += count - 1;
+    }
+
+    size_t NetCount() const { return previous.size(); }
+    unsigned long long Samples() const { return samples; }
+    unsigned long long Transitions() const { return samples > 1 ? samples - 1 : 0; }
+    const std::vector<unsigned long long>& Toggles() const { return toggles; }
+    const std::vector<BusWord>& ToggledLanes() const { return toggledLanes; }
+};
+
+// Toggles per lane per transition (0 = never switches, 1 = switches every tick)
+inline double SwitchingActivity(unsigned long long toggles, unsigned long long transitions, int width) {
+    return transitions > 0 ? (double)toggles / ((double)transitions * width) : 0.0;
+}
+
+// Net lanes (bits) of a circuit, and how many of them ever toggled. Net 0 (constant low) is left out.
+void CountToggledBits(const CompiledCircuit& circuit, const ToggleCoverage& coverage,
+    size_t& toggledBits, size_t& totalBits);
+
+// One line per node output: node, type, pin, width, toggles, activity, and the
+// lanes that never toggled, flagged UNTESTED
+void WriteCoverageReport(std::ostream& out, const CircuitDescription& description,
+    const CompiledCircuit& circuit, const ToggleCoverage& coverage);
+
+#endif // COVERAGE_H
@@ -0,0 +1,245 @@
+#include "DynamicTopology.h"
+#include <algorithm>
+
+// ================================
+// DYNAMIC TOPOLOGICAL ORDER IMPLEMENTATION
+// ================================
+
+// Drop one occurrence of value from an adjacency list; false if it isn't there
+template <typename List>
+static bool RemoveOne(List& list, int value) {
+    for (size_t i = 0; i < list.size(); i++) {
+        if (list[i] == value) {
+            list[i] = list.back();
+            list.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+// New nodes have no edges yet, so they can take the next free positions
+void DynamicTopology::Grow(int node) {
+    while ((int)position.size() <= node) {
+        position.push_back((int)position.size());
+        nodeAt.push_back((int)nodeAt.size());
+    }
+    successors.resize(position.size());
+    predecessors.resize(position.size());
+    visited.resize(position.size(), 0);
+}
+
+// Depth-first search forward from a node through nodes positioned at or before limit;
+// marks and collects what it reaches, and reports whether target was among them
+bool DynamicTopology::ReachesWithin(int from, int target, int limit, std::vector<int>* reached) const {
+    bool found = false;
+    stack.clear();
+    stack.push_back(from);
+    visited[from] = 1;
+    reached->push_back(from);
+    while (!stack.empty() && !found) {
+        int node = stack.back();
+        stack.pop_back();
+        const SmallVector<int, 4>& next = successors[node];
+        for (size_t i = 0; i < next.size(); i++) {
+            int successor = next[i];
+            if (successor == target) {
+                found = true;
+                break;
+            }
+            if (visited[successor] || position[successor] > limit) continue;
+            visited[successor] = 1;
+            reached->push_back(successor);
+            stack.push_back(successor);
+        }
+    }
+    return found;
+}
+
+// Depth-first search backward from a node through nodes positioned after limit
+void DynamicTopology::CollectBackward(int from, int limit) {
+    stack.clear();
+    stack.push_back(from);
+    visited[from] = 1;
+    backward.push_back(from);
+    while (!stack.empty()) {
+        int node = stack.back();
+        stack.pop_back();
+        const SmallVector<int, 2>& previous = predecessors[node];
+        for (size_t i = 0; i < previous.size(); i++) {
+            int predecessor = previous[i];
+            if (visited[predecessor] || position[predecessor] <= limit) continue;
+            visited[predecessor] = 1;
+            backward.push_back(predecessor);
+            stack.push_back(predecessor);
+        }
+    }
+}
+
+void DynamicTopology::ClearMarks(const std::vector<int>& nodes) const {
+    for (int node : nodes) visited[node] = 0;
+}
+
+// Pearce-Kelly insertion: if to sits before from, find what from must still precede
+// (forward of to) and what must precede from (backward of from) within the
+// positions between them, then hand those positions out again with the backward
+// set first. Nothing outside that window moves.
+bool DynamicTopology::Insert(int from, int to) {
+    int lower = position[to];
+    int upper = position[from];
+    if (from == to) return false;
+
+    if (lower < upper) {
+        forward.clear();
+        bool loop = ReachesWithin(to, from, upper, &forward);
+        if (loop) {
+            ClearMarks(forward);
+            return false;
+        }
+        backward.clear();
+        CollectBackward(from, lower);
+
+        auto byPosition = [this](int a, int b) { return position[a] < position[b]; };
+        std::sort(forward.begin(), forward.end(), byPosition);
+        std::sort(backward.begin(), backward.end(), byPosition);
+
+        slots.clear();
+        for (int node : backward) slots.push_back(position[node]);
+        for (int node : forward) slots.push_back(position[node]);
+        std::sort(slots.begin(), slots.end());
+
+        size_t slot = 0;
+        for (int node : backward) {
+            position[node] = slots[slot];
+            nodeAt[slots[slot++]] = node;
+        }
+        for (int node : forward) {
+            position[node] = slots[slot];
+            nodeAt[slots[slot++]] = node;
+        }
+        ClearMarks(forward);
+        ClearMarks(backward);
+    }
+
+    successors[from].push_back(to);
+    predecessors[to].push_back(from);
+    return true;
+}
+
+bool DynamicTopology::AddEdge(int from, int to, bool clockedSource) {
+    if (clockedSource) return true;
+    Grow(std::max(from, to));
+    if (Insert(from, to)) return true;
+    loopEdges.push_back(std::make_pair(from, to));
+    return false;
+}
+
+void DynamicTopology::AddEdgeUnordered(int from, int to, bool clockedSource) {
+    if (clockedSource) return;
+    Grow(std::max(from, to));
+    successors[from].push_back(to);
+    predecessors[to].push_back(from);
+}
+
+// Order everything afresh: depth first from each node in the current order, finishing
+// order reversed. An edge back to a node still being searched closes a loop; it is
+// set aside as a loop edge, and every held edge left agrees with the new order.
+void DynamicTopology::Rebuild() {
+    int nodeCount = (int)position.size();
+    for (const std::pair<int, int>& edge : loopEdges) {
+        successors[edge.first].push_back(edge.second);
+        predecessors[edge.second].push_back(edge.first);
+    }
+    loopEdges.clear();
+
+    std::vector<char> state(nodeCount, 0);      // 0 unseen, 1 being searched, 2 finished
+    std::vector<std::pair<int, int>> search;    // (node, next successor to follow)
+    std::vector<int> finished;
+    finished.reserve(nodeCount);
+    for (int root : nodeAt) {
+        if (state[root] != 0) continue;
+        state[root] = 1;
+        search.push_back(std::make_pair(root, 0));
+        while (!search.empty()) {
+            int node = search.back().first;
+            if (search.back().second < (int)successors[node].size()) {
+                int next = successors[node][search.back().second++];
+                if (state[next] == 1) loopEdges.push_back(std::make_pair(node, next));
+                else if (state[next] == 0) {
+                    state[next] = 1;
+                    search.push_back(std::make_pair(next, 0));
+                }
+                continue;
+            }
+            state[node] = 2;
+            finished.push_back(node);
+            search.pop_back();
+        }
+    }
+
+    for (const std::pair<int, int>& edge : loopEdges) {
+        RemoveOne(successors[edge.first], edge.second);
+        RemoveOne(predecessors[edge.second], edge.first);
+    }
+    for (int i = 0; i < nodeCount; i++) {
+        int node = finished[nodeCount - 1 - i];
+        position[node] = i;
+        nodeAt[i] = node;
+    }
+}
+
+void DynamicTopology::RemoveEdge(int from, int to) {
+    if (std::max(from, to) >= (int)position.size()) return;
+
+    for (size_t i = 0; i < loopEdges.size(); i++) {
+        if (loopEdges[i] == std::make_pair(from, to)) {
+            loopEdges[i] = loopEdges.back();
+            loopEdges.pop_back();
+            return;
+        }
+    }
+    if (!RemoveOne(successors[from], to)) return;
+    RemoveOne(predecessors[to], from);
+
+    // A loop edge a -> b was closed by a path b ... a, which can only have run
+    // through this edge if the edge lies between b and a in the order
+    for (size_t i = 0; i < loopEdges.size();) {
+        int a = loopEdges[i].first;
+        int b = loopEdges[i].second;
+        if (position[b] <= position[from] && position[to] <= position[a] && Insert(a, b)) {
+            loopEdges[i] = loopEdges.back();
+            loopEdges.pop_back();
+        }
+        else {
+            i++;
+        }
+    }
+}
+
+void DynamicTopology::Clear() {
+    position.clear();
+    nodeAt.clear();
+    successors.clear();
+    predecessors.clear();
+    loopEdges.clear();
+    visited.clear();
+}
+
+void DynamicTopology::Reserve(size_t nodeCount) {
+    position.reserve(nodeCount);
+    nodeAt.reserve(nodeCount);
+    successors.reserve(nodeCount);
+    predecessors.reserve(nodeCount);
+    visited.reserve(nodeCount);
+}
+
+bool DynamicTopology::WouldCloseLoop(int from, int to, bool clockedSource) const {
+    if (clockedSource) return false;
+    if (from == to) return true;
+    if (std::max(from, to) >= (int)position.size() || position[from] < position[to]) return false;
+
+    probe.clear();
+    bool loop = ReachesWithin(to, from, position[from], &probe);
+    ClearMarks(probe);
+    return loop;
+}
@@ -0,0 +1,64 @@
+#ifndef DYNAMIC_TOPOLOGY_H
+#define DYNAMIC_TOPOLOGY_H
+
+#include "SmallVector.h"
+#include <utility>
+#include <vector>
+
+// ================================
+// DYNAMIC TOPOLOGICAL ORDER (no raylib dependency)
+// ================================
+
+// A topological order of the gate graph kept valid as wires come and go
+// (Pearce and Kelly's algorithm). Nodes are gate slots. Adding an edge that
+// already agrees with the order costs nothing; otherwise only the nodes whose
+// positions lie between its two ends are searched and shuffled, so edits cost
+// the size of the region they disturb rather than the whole design.
+//
+// Wires out of clocked gates carry last cycle's state and place no constraint.
+// A wire that would close a combinational loop is still allowed (latches are
+// built that way) but is held aside as a loop edge outside the order; it
+// rejoins the order if a later removal breaks its loop.
+class DynamicTopology {
+private:
+    std::vector<int> position;          // Position of each node in the order
+    std::vector<int> nodeAt;            // Node at each position
+    std::vector<SmallVector<int, 4>> successors;
+    std::vector<SmallVector<int, 2>> predecessors;
+    std::vector<std::pair<int, int>> loopEdges;
+
+    // Search scratch
+    mutable std::vector<char> visited;
+    mutable std::vector<int> stack;
+    mutable std::vector<int> probe;
+    std::vector<int> forward, backward, slots;
+
+    void Grow(int node);
+    bool ReachesWithin(int from, int target, int limit, std::vector<int>* reached) const;
+    void CollectBackward(int from, int limit);
+    void ClearMarks(const std::vector<int>& nodes) const;
+    bool Insert(int from, int to);      // False if the edge would close a loop
+
+public:
+    // Add a wire's edge; false if it closes a combinational loop (it is kept as a loop edge)
+    bool AddEdge(int from, int to, bool clockedSource);
+    void RemoveEdge(int from, int to);   // Edges out of clocked gates were never held, so need no flag
+
+    // Bulk loads: add edges without keeping the order (AddEdge repairs it one edge at a
+    // time, which on a large netlist arriving in no particular order adds up to quadratic),
+    // then put the order right with Rebuild in one depth-first pass. Edges that pass
+    // closes loops with become the loop edges.
+    void AddEdgeUnordered(int from, int to, bool clockedSource);
+    void Rebuild();
+    void Clear();
+    void Reserve(size_t nodeCount);     // Room for nodes below nodeCount, ahead of a bulk load
+
+    // True if a new edge would close a combinational loop; touches only the region between its ends
+    bool WouldCloseLoop(int from, int to, bool clockedSource) const;
+
+    // Position of every node in the order (a node's drivers come before it, loop edges aside)
+    const std::vector<int>& Positions() const { return position; }
+    size_t LoopEdgeCount() const { return loopEdges.size(); }
+};
+
+#endif // DYNAMIC_TOPOLOGY_H
@@ -0,0 +1,175 @@
+#include "EditHistory.h"
+
+// ================================
+// EDIT HISTORY IMPLEMENTATION
+// ================================
+
+// Record a new edit; anything that was undone can no longer be redone
+void EditHistory::Push(Command command) {
+    redoStack.clear();
+    undoStack.push_back(std::move(command));
+    if ((int)undoStack.size() > UNDO_HISTORY_LIMIT) {
+        undoStack.pop_front();
+    }
+}
+
+void EditHistory::RecordPlace(GateHandle gate, const Gate& placed) {
+    Command command;
+    command.type = CommandType::PLACE_GATES;
+    command.gates.push_back(Describe(gate, placed));
+    Push(std::move(command));
+}
+
+void EditHistory::RecordPlace(const std::vector<GateHandle>& placed, const GateStore& gates) {
+    Command command;
+    command.type = CommandType::PLACE_GATES;
+    command.gates.reserve(placed.size());
+    for (GateHandle handle : placed) {
+        const std::unique_ptr<Gate>* gate = gates.Get(handle);
+        if (gate) command.gates.push_back(Describe(handle, **gate));
+    }
+    if (!command.gates.empty()) Push(std::move(command));
+}
+
+void EditHistory::RecordMove(GateHandle gate, Vector2 from, Vector2 to) {
+    Command command;
+    command.type = CommandType::MOVE_GATE;
+    command.gate = gate;
+    command.from = from;
+    command.to = to;
+    Push(std::move(command));
+}
+
+void EditHistory::RecordDelete(GateHandle gate, const Gate& deleted, std::vector<WireRecord> wires) {
+    Command command;
+    command.type = CommandType::DELETE_GATES;
+    command.gates.push_back(Describe(gate, deleted));
+    command.wires = std::move(wires);
+    Push(std::move(command));
+}
+
+void EditHistory::RecordDelete(const std::vector<GateHandle>& deleted, const GateStore& gates,
+    std::vector<WireRecord> wires) {
+    Command command;
+    command.type = CommandType::DELETE_GATES;
+    command.gates.reserve(deleted.size());
+    for (GateHandle handle : deleted) {
+        const std::unique_ptr<Gate>* gate = gates.Get(handle);
+        if (gate) command.gates.push_back(Describe(handle, **gate));
+    }
+    command.wires = std::move(wires);
+    if (!command.gates.empty()) Push(std::move(command));
+}
+
+void EditHistory::RecordAddWire(const WireRecord& wire) {
+    Command command;
+    command.type = CommandType::ADD_WIRE;
+    command.wires.push_back(wire);
+    Push(std::move(command));
+}
+
+void EditHistory::RecordRemoveWire(WireRecord wire) {
+    Command command;
+    command.type = CommandType::REMOVE_WIRE;
+    command.wires.push_back(std::move(wire));
+    Push(std::move(command));
+}
+
+// Step backwards
+bool EditHistory::Undo(GateStore& gates, WiringSystem& wiring) {
+    if (undoStack.empty()) return false;
+
+    Command command = std::move(undoStack.back());
+    undoStack.pop_back();
+    Apply(command, false, gates, wiring);
+    redoStack.push_back(std::move(command));
+    return true;
+}
+
+// Step forwards
+bool EditHistory::Redo(GateStore& gates, WiringSystem& wiring) {
+    if (redoStack.empty()) return false;
+
+    Command command = std::move(redoStack.back());
+    redoStack.pop_back();
+    Apply(command, true, gates, wiring);
+    undoStack.push_back(std::move(command));
+    return true;
+}
+
+void EditHistory::Clear() {
+    undoStack.clear();
+    redoStack.clear();
+}
+
+// Apply a command forwards (redo) or backwards (undo)
+void EditHistory::Apply(Command& command, bool forward, GateStore& gates, WiringSystem& wiring) {
+    switch (command.type) {
+    case CommandType::PLACE_GATES:
+    case CommandType::DELETE_GATES:
+        if ((command.type == CommandType::PLACE_GATES) == forward) InsertGates(command, gates, wiring);
+        else RemoveGates(command, gates, wiring);
+        break;
+
+    case CommandType::MOVE_GATE: {
+        std::unique_ptr<Gate>* gate = gates.Get(command.gate);
+        if (!gate) break;
+        (*gate)->position = forward ? command.to : command.from;
+        wiring.RequestRerouteForGate(command.gate, gates, true);
+        break;
+    }
+
+    case CommandType::ADD_WIRE:
+    case CommandType::REMOVE_WIRE: {
+        bool adding = (command.type == CommandType::ADD_WIRE) == forward;
+        if (adding) wiring.RestoreWire(command.wires[0], gates);
+        else wiring.DeleteWire(command.wires[0].handle, &command.wires[0]);
+        break;
+    }
+    }
+}
+
+// What the log keeps of a gate
+EditHistory::GateRecord EditHistory::Describe(GateHandle handle, const Gate& gate) {
+    GateRecord record;
+    record.handle = handle;
+    record.type = gate.GetType();
+    record.definition = gate.GetDefinition();
+    record.width = gate.GetWidth();
+    record.position = gate.position;
+    record.inputState = gate.input1;
+    return record;
+}
+
+// Bring gates back under their recorded handles, then the wires they lost
+void EditHistory::InsertGates(Command& command, GateStore& gates, WiringSystem& wiring) {
+    if (command.gates.size() > 1) {
+        Gate::ReservePool(command.gates.size());
+        gates.Reserve(gates.size() + command.gates.size());
+        wiring.Reserve(command.wires.size(), gates.SlotCount());
+    }
+    for (const GateRecord& record : command.gates) {
+        auto gate = std::make_unique<Gate>(record.type, record.position, record.definition, record.width);
+        if (record.type == GateType::INPUT) {
+            gate->input1 = record.inputState;
+        }
+        gates.Restore(record.handle, std::move(gate));
+    }
+    for (const WireRecord& wire : command.wires) {
+        wiring.RestoreWire(wire, gates);
+    }
+}
+
+// Remove gates and their wires, keeping what is needed to put them back
+void EditHistory::RemoveGates(Command& command, GateStore& gates, WiringSystem& wiring) {
+    command.wires.clear();
+    for (GateRecord& record : command.gates) {
+        std::unique_ptr<Gate>* gate = gates.Get(record.handle);
+        if (!gate) continue;
+
+        record.position = (*gate)->position;
+        record.inputState = (*gate)->input1;
+        wiring.RemoveWiresForGate(record.handle, &command.wires);
+        gates.Erase(record.handle);
+    }
+}
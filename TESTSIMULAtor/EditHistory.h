@@ -0,0 +1,77 @@
+#ifndef EDIT_HISTORY_H
+#define EDIT_HISTORY_H
+
+#include "raylib.h"
+#include "Constants.h"
+#include "Gate.h"
+#include "WiringSystem.h"
+#include <vector>
+#include <deque>
+
+// ================================
+// EDIT HISTORY DECLARATION
+// ================================
+
+// Undo/redo log of small reversible commands. Each command stores only what
+// the edit touched (gates' types and positions, wires' endpoints and routes),
+// so memory follows the size of the edits rather than the design, and undo or
+// redo costs the same as the original edit. Items come back under their old
+// handles (SlotMap::Restore), so later commands in the log stay valid.
+class EditHistory {
+private:
+    enum class CommandType {
+        PLACE_GATES, MOVE_GATE, DELETE_GATES, ADD_WIRE, REMOVE_WIRE
+    };
+
+    // Everything needed to put a removed gate back under its old handle
+    struct GateRecord {
+        GateHandle handle;
+        GateType type = GateType::INPUT;
+        int definition = -1;              // Subcircuit definition of the gate
+        int width = 1;                    // Bus width of the gate
+        Vector2 position = { 0, 0 };
+        BusWord inputState = 0;           // Value of an INPUT gate
+    };
+
+    struct Command {
+        CommandType type;
+        GateHandle gate;                  // Gate moved
+        Vector2 from = { 0, 0 };          // Position before and after a move
+        Vector2 to = { 0, 0 };
+        std::vector<GateRecord> gates;    // Gates placed or deleted (one, or a whole paste or selection)
+        std::vector<WireRecord> wires;    // Wire added/removed, or wires lost with deleted gates
+    };
+
+    std::deque<Command> undoStack;
+    std::deque<Command> redoStack;
+
+    void Push(Command command);
+
+    // Apply a command forwards or backwards
+    void Apply(Command& command, bool forward, GateStore& gates, WiringSystem& wiring);
+
+    static GateRecord Describe(GateHandle handle, const Gate& gate);
+    static void InsertGates(Command& command, GateStore& gates, WiringSystem& wiring);
+    static void RemoveGates(Command& command, GateStore& gates, WiringSystem& wiring);
+
+public:
+    // Record edits right after they were made
+    void RecordPlace(GateHandle gate, const Gate& placed);
+    void RecordPlace(const std::vector<GateHandle>& placed, const GateStore& gates);    // One step for a whole paste
+    void RecordMove(GateHandle gate, Vector2 from, Vector2 to);   // Once per drag, on release
+    void RecordDelete(GateHandle gate, const Gate& deleted, std::vector<WireRecord> wires);
+    void RecordDelete(const std::vector<GateHandle>& deleted, const GateStore& gates,
+        std::vector<WireRecord> wires);   // One step for a selection; call before erasing the gates
+    void RecordAddWire(const WireRecord& wire);
+    void RecordRemoveWire(WireRecord wire);
+
+    // Step backwards/forwards; false if there is nothing to do
+    bool Undo(GateStore& gates, WiringSystem& wiring);
+    bool Redo(GateStore& gates, WiringSystem& wiring);
+
+    bool CanUndo() const { return !undoStack.empty(); }
+    bool CanRedo() const { return !redoStack.empty(); }
+    void Clear();
+};
+
+#endif // EDIT_HISTORY_H
@@ -1,6 +1,10 @@
 #include "Gate.h"
+#include "Netlist.h"
+#include "ObjectPool.h"
 #include <iostream>
+#include <algorithm>
 #include <string> // Add this for string conversions
+#include <cstdio>
 
 // Stream operator for GateType enum
 std::ostream& operator<<(std::ostream& os, const GateType& type) {
@@ -12,17 +16,76 @@ std::ostream& operator<<(std::ostream& os, const GateType& type) {
     case GateType::NOT:    return os << "NOT";
     case GateType::NAND:   return os << "NAND";
     case GateType::NOR:    return os << "NOR";
+    case GateType::SUBCIRCUIT: return os << "SUBCIRCUIT";
+    case GateType::CLOCK:  return os << "CLOCK";
+    case GateType::DFF:    return os << "DFF";
+    case GateType::REGISTER: return os << "REGISTER";
     default:               return os << "UNKNOWN";
     }
 }
 
+// Bounds of every gate indexed by slot (empty for free slots)
+std::vector<Rectangle> SnapshotGateBounds(const GateStore& gates) {
+    std::vector<Rectangle> gateBounds(gates.SlotCount(), Rectangle{ 0, 0, 0, 0 });
+    for (size_t i = 0; i < gates.size(); i++) {
+        gateBounds[gates.HandleAt(i).index] = gates[i]->GetBounds();
+    }
+    return gateBounds;
+}
+
+// Text for a bus value: hex, zero-padded to the bus width
+static std::string FormatBusValue(BusWord value, int width) {
+    char text[24];
+    snprintf(text, sizeof(text), "%0*llX", (width + 3) / 4, value);
+    return text;
+}
+
 // ================================
 // GATE CLASS IMPLEMENTATION
 // ================================
 
+// Pooled allocation; anything of another size (a derived class) uses the heap
+static ObjectPool<Gate>& GatePool() {
+    static ObjectPool<Gate> pool;
+    return pool;
+}
+
+void* Gate::operator new(size_t size) {
+    return size == sizeof(Gate) ? GatePool().Allocate() : ::operator new(size);
+}
+
+void Gate::operator delete(void* pointer, size_t size) {
+    if (size == sizeof(Gate)) GatePool().Free(pointer);
+    else ::operator delete(pointer);
+}
+
+void Gate::ReservePool(size_t count) {
+    GatePool().Reserve(count);
+}
+
 // Constructor
-Gate::Gate(GateType t, Vector2 pos) : type(t), position(pos) {
+Gate::Gate(GateType t, Vector2 pos, int definitionId, int busWidth) : type(t), position(pos) {
     info = GATE_DATA.at(t);
+
+    if (type == GateType::SUBCIRCUIT) {
+        // One block per instance, sized to fit its ports and labelled with the definition name
+        const CompiledCircuit* circuit = SUBCIRCUITS.Get(definitionId);
+        definition = circuit ? definitionId : -1;
+        size_t inputs = circuit ? circuit->inputNets.size() : 0;
+        size_t outputs = circuit ? circuit->outputNets.size() : 0;
+        portInputs.assign(inputs, 0);
+        portOutputs.assign(outputs, 0);
+        info.size.y = (float)(std::max<size_t>(std::max(inputs, outputs), 1) + 1) * SUBCIRCUIT_PIN_SPACING;
+        if (circuit) info.label = circuit->name.c_str();
+    }
+    else {
+        width = std::min(std::max(busWidth, 1), MAX_BUS_WIDTH);
+
+        // Bus I/O show their value in hex, so widen them to fit the digits
+        if (width > 1 && (type == GateType::INPUT || type == GateType::OUTPUT)) {
+            info.size.x = std::max(info.size.x, ((width + 3) / 4) * 11.0f + 16.0f);
+        }
+    }
 }
 
 // Getters
@@ -42,29 +105,30 @@ const char* Gate::GetLabel() const {
     return info.label;
 }
 
+int Gate::GetDefinition() const {
+    return definition;
+}
+
+int Gate::GetWidth() const {
+    return width;
+}
+
 // Logic computation
 void Gate::ComputeOutput() {
-    switch (type) {
-    case GateType::INPUT:
-    case GateType::OUTPUT:
-        output = input1;
-        break;
-    case GateType::AND:
-        output = input1 && input2;
-        break;
-    case GateType::OR:
-        output = input1 || input2;
-        break;
-    case GateType::NOT:
-        output = !input1;
-        break;
-    case GateType::NAND:
-        output = !(input1 && input2);
-        break;
-    case GateType::NOR:
-        output = !(input1 || input2);
-        break;
+    if (type == GateType::SUBCIRCUIT) {
+        // Evaluated through the shared compiled definition
+        SUBCIRCUITS.Evaluate(definition, portInputs.data(), portOutputs.data());
+        output = portOutputs.empty() ? 0 : portOutputs[0];
+        return;
     }
+    if (IsClocked(type)) return;   // Holds its state until ClockEdge
+    output = EvaluateWord(type, input1, input2, BusMask(width));
+}
+
+// End of a cycle: clocked gates load their next state from the current inputs
+void Gate::ClockEdge() {
+    if (!IsClocked(type)) return;
+    output = NextState(type, output, input1, input2, BusMask(width));
 }
 
 // Collision and boundary methods
@@ -82,6 +146,11 @@ bool Gate::CollidesWith(const Gate& other) const {
 
 // Connection point helpers
 Vector2 Gate::GetInputPoint(int inputIndex) const {
+    // Subcircuit ports run down the left edge
+    if (type == GateType::SUBCIRCUIT) {
+        return { position.x - 8, position.y + SUBCIRCUIT_PIN_SPACING * (inputIndex + 1) };
+    }
+
     // For INPUT and OUTPUT gates, center the connection point
     if (type == GateType::INPUT || type == GateType::OUTPUT) {
         return { position.x - 8, position.y + info.size.y * 0.5f };
@@ -98,13 +167,21 @@ Vector2 Gate::GetInputPoint(int inputIndex) const {
         float offsetY = (inputIndex == 0) ? info.size.y * 0.33f : info.size.y * 0.66f;
         return { position.x - 12, position.y + offsetY }; // Moved 12 pixels away instead of at edge
     } else {
-        // For non-textured gates, use original offset logic
+        // For non-textured gates, use original offset logic (a lone input sits centred)
+        if (GetInputCount() == 1) {
+            return { position.x - 8, position.y + info.size.y * 0.5f };
+        }
         float offsetY = (inputIndex == 0) ? info.size.y * 0.33f : info.size.y * 0.66f;
         return { position.x - 8, position.y + offsetY };
     }
 }
 
-Vector2 Gate::GetOutputPoint() const {
+Vector2 Gate::GetOutputPoint(int outputIndex) const {
+    // Subcircuit ports run down the right edge
+    if (type == GateType::SUBCIRCUIT) {
+        return { position.x + info.size.x + 8, position.y + SUBCIRCUIT_PIN_SPACING * (outputIndex + 1) };
+    }
+
     // Adjust output connection point to be further from gate edge
     if (info.texture.id != 0 && type != GateType::INPUT && type != GateType::OUTPUT) {
         // For textured gates, place connection point further from the actual gate output edge
@@ -116,46 +193,135 @@ Vector2 Gate::GetOutputPoint() const {
 }
 
 int Gate::GetInputCount() const {
-    switch (type) {
-    case GateType::INPUT:
-        return 0;  // No inputs
-    case GateType::OUTPUT:
-    case GateType::NOT:
-        return 1;  // Single input
-    case GateType::AND:
-    case GateType::OR:
-    case GateType::NAND:
-    case GateType::NOR:
-        return 2;  // Two inputs
-    default:
-        return 0;
-    }
+    if (type == GateType::SUBCIRCUIT) return (int)portInputs.size();
+    return PrimitiveInputCount(type);
+}
+
+int Gate::GetOutputCount() const {
+    if (type == GateType::SUBCIRCUIT) return (int)portOutputs.size();
+    return PrimitiveOutputCount(type);
 }
 
 bool Gate::HasOutput() const {
-    return type != GateType::OUTPUT;  // All gates except OUTPUT have outputs
+    return GetOutputCount() > 0;  // All gates except OUTPUT have outputs
+}
+
+// Bus width of a pin (subcircuit ports take theirs from the definition)
+int Gate::GetInputWidth(int inputIndex) const {
+    if (type == GateType::SUBCIRCUIT) {
+        const CompiledCircuit* circuit = SUBCIRCUITS.Get(definition);
+        return (circuit && inputIndex >= 0 && inputIndex < (int)circuit->inputWidths.size()) ? circuit->inputWidths[inputIndex] : 1;
+    }
+    return width;
+}
+
+int Gate::GetOutputWidth(int outputIndex) const {
+    if (type == GateType::SUBCIRCUIT) {
+        const CompiledCircuit* circuit = SUBCIRCUITS.Get(definition);
+        return (circuit && outputIndex >= 0 && outputIndex < (int)circuit->outputWidths.size()) ? circuit->outputWidths[outputIndex] : 1;
+    }
+    return width;
+}
+
+// Pin values by number
+BusWord Gate::GetInputState(int inputIndex) const {
+    if (type == GateType::SUBCIRCUIT) {
+        return (inputIndex >= 0 && inputIndex < (int)portInputs.size()) ? portInputs[inputIndex] : 0;
+    }
+    return (inputIndex == 0) ? input1 : input2;
+}
+
+void Gate::SetInputState(int inputIndex, BusWord value) {
+    if (type == GateType::SUBCIRCUIT) {
+        if (inputIndex >= 0 && inputIndex < (int)portInputs.size()) portInputs[inputIndex] = value;
+    }
+    else if (inputIndex == 0) {
+        input1 = value;
+    }
+    else if (inputIndex == 1) {
+        input2 = value;
+    }
+}
+
+BusWord Gate::GetOutputState(int outputIndex) const {
+    if (type == GateType::SUBCIRCUIT) {
+        return (outputIndex >= 0 && outputIndex < (int)portOutputs.size()) ? portOutputs[outputIndex] : 0;
+    }
+    return output;
+}
+
+void Gate::SetOutputState(int outputIndex, BusWord value) {
+    if (type == GateType::SUBCIRCUIT) {
+        if (outputIndex >= 0 && outputIndex < (int)portOutputs.size()) portOutputs[outputIndex] = value;
+        if (outputIndex == 0) output = value;
+    }
+    else if (outputIndex == 0) {
+        output = value;
+    }
+}
+
+void Gate::ResetInputs() {
+    input1 = 0;
+    input2 = 0;
+    unknownPins = 0;
+    floatingPins = 0;
+    std::fill(portInputs.begin(), portInputs.end(), 0);
+}
+
+// Step an INPUT gate's value, wrapping within its width
+void Gate::StepInputValue(int delta) {
+    if (type != GateType::INPUT) return;
+    input1 = (input1 + (BusWord)(long long)delta) & BusMask(width);
+}
+
+// Pin values folded into one word, for change detection. One-bit primitives
+// pack their pins exactly; wider values are hashed, so a missed change is
+// possible in principle but vanishingly rare.
+unsigned long long Gate::GetStateSignature() const {
+    if (type != GateType::SUBCIRCUIT && width == 1 && (unknownPins | floatingPins) == 0) {
+        return input1 | (input2 << 1) | (output << 2);
+    }
+
+    unsigned long long signature = 0xCBF29CE484222325ULL;
+    auto fold = [&signature](BusWord value) {
+        signature = (signature ^ value) * 0x100000001B3ULL;
+        signature ^= signature >> 29;
+    };
+    if (type == GateType::SUBCIRCUIT) {
+        for (BusWord value : portInputs) fold(value);
+        for (BusWord value : portOutputs) fold(value);
+    }
+    else {
+        fold(input1);
+        fold(input2);
+        fold(output);
+    }
+    fold(unknownPins);
+    fold(floatingPins);
+    return signature;
 }
 
 // Get all connection points for this gate
-std::vector<ConnectionPoint> Gate::GetConnectionPoints(int gateIndex) const {
+std::vector<ConnectionPoint> Gate::GetConnectionPoints(GateHandle handle) const {
     std::vector<ConnectionPoint> points;
 
     // Add input points
     int inputCount = GetInputCount();
     for (int i = 0; i < inputCount; i++) {
-        points.emplace_back(GetInputPoint(i), true, gateIndex, i);
+        points.emplace_back(GetInputPoint(i), true, handle, i);
     }
 
-    // Add output point
-    if (HasOutput()) {
-        points.emplace_back(GetOutputPoint(), false, gateIndex, 0);
+    // Add output points
+    int outputCount = GetOutputCount();
+    for (int i = 0; i < outputCount; i++) {
+        points.emplace_back(GetOutputPoint(i), false, handle, i);
     }
 
     return points;
 }
 
 // Check if an input is connected
-bool Gate::IsInputConnected(int inputIndex, const std::vector<std::unique_ptr<Wire>>& wires) const {
+bool Gate::IsInputConnected(int inputIndex, const WireStore& wires) const {
     for (const auto& wire : wires) {
         if (wire->toInputIndex == inputIndex) {
             return true;
@@ -170,10 +336,10 @@ void Gate::DrawConnectionPoints() const {
     int inputCount = GetInputCount();
     for (int i = 0; i < inputCount; i++) {
         Vector2 inputPos = GetInputPoint(i);
-        bool inputState = (i == 0) ? input1 : input2;
+        bool inputState = GetInputState(i) != 0;
 
         // Draw clean, smooth connection points
-        Color innerColor = inputState ? RED : DARKGRAY;
+        Color innerColor = PinColor(i, inputState);
         Color outerColor = WHITE;
         
         // Draw layered circles for smooth appearance
@@ -184,12 +350,15 @@ void Gate::DrawConnectionPoints() const {
         DrawCircleLinesV(inputPos, CONNECTION_POINT_RADIUS, BLACK);
     }
 
-    // Draw output points for NAND, NOR, NOT, and INPUT gates
-    if (HasOutput() && (type == GateType::NAND || type == GateType::NOR || type == GateType::NOT || type == GateType::INPUT)) {
-        Vector2 outputPos = GetOutputPoint();
+    // Draw output points for NAND, NOR, NOT, INPUT, clocked and subcircuit gates
+    bool drawsOutputs = type == GateType::NAND || type == GateType::NOR || type == GateType::NOT ||
+        type == GateType::INPUT || type == GateType::SUBCIRCUIT || IsClocked(type);
+    int outputCount = drawsOutputs ? GetOutputCount() : 0;
+    for (int i = 0; i < outputCount; i++) {
+        Vector2 outputPos = GetOutputPoint(i);
 
         // Draw clean, smooth output point
-        Color innerColor = output ? RED : DARKGRAY;
+        Color innerColor = PinColor(OUTPUT_PIN_BIT + i, GetOutputState(i) != 0);
         Color outerColor = WHITE;
         
         // Draw layered circles for smooth appearance
@@ -201,6 +370,19 @@ void Gate::DrawConnectionPoints() const {
     }
 }
 
+// Centre colour of a pin: its signal, or whether it is floating or unknown in four-valued simulation
+Color Gate::PinColor(int pinBit, bool state) const {
+    if (pinBit < 64 && ((floatingPins >> pinBit) & 1)) return FLOATING_SIGNAL_COLOR;
+    if (pinBit < 64 && ((unknownPins >> pinBit) & 1)) return UNKNOWN_SIGNAL_COLOR;
+    return state ? RED : DARKGRAY;
+}
+
+// Bus width written above the top-right corner, like the slash-and-number on a schematic bus
+void Gate::DrawWidthTag() const {
+    std::string widthTag = "/" + std::to_string(width);
+    DrawText(widthTag.c_str(), (int)(position.x + info.size.x) - MeasureText(widthTag.c_str(), 10), (int)position.y - 12, 10, DARKBLUE);
+}
+
 // Rendering
 void Gate::Draw(bool preview, bool highlight) const {
     Rectangle body = GetBounds();
@@ -214,10 +396,10 @@ void Gate::Draw(bool preview, bool highlight) const {
         Color tint = WHITE;
         if (preview) tint.a = 128; // Make transparent if preview
         
-        // Draw the texture without color tinting
+        // Draw the gate's part of the atlas without color tinting
         DrawTexturePro(
             info.texture,
-            {0, 0, (float)info.texture.width, (float)info.texture.height}, // source rectangle
+            info.atlasRect, // source rectangle
             body, // destination rectangle
             {0, 0}, // origin
             0.0f, // rotation
@@ -235,14 +417,14 @@ void Gate::Draw(bool preview, bool highlight) const {
         if (type == GateType::INPUT || type == GateType::OUTPUT) {
             // For INPUT and OUTPUT gates, show digital state
             if (!preview) {
-                const char* stateText = output ? "1" : "0";
-                int fontSize = 24;
-                int stateWidth = MeasureText(stateText, fontSize);
+                std::string stateText = (width > 1) ? FormatBusValue(output, width) : (output ? "1" : "0");
+                int fontSize = (width > 1) ? 18 : 24;
+                int stateWidth = MeasureText(stateText.c_str(), fontSize);
                 Vector2 statePos = {
                     position.x + (info.size.x - stateWidth) / 2,
                     position.y + (info.size.y - fontSize) / 2
                 };
-                DrawText(stateText, (int)statePos.x, (int)statePos.y, fontSize, output ? LIME : RED);
+                DrawText(stateText.c_str(), (int)statePos.x, (int)statePos.y, fontSize, output ? LIME : RED);
             }
         } else {
             // Show the label for gates without textures
@@ -259,8 +441,97 @@ void Gate::Draw(bool preview, bool highlight) const {
         DrawRectangleLinesEx(body, highlight ? 3 : 2, highlight ? YELLOW : BLACK);
     }
 
+    // Bus gates carry their width above the body
+    if (width > 1 && type != GateType::INPUT && type != GateType::OUTPUT) {
+        DrawWidthTag();
+    }
+
     // Draw connection points (only if not preview)
     if (!preview) {
         DrawConnectionPoints();
     }
+}
+
+// Batched version of DrawConnectionPoints()
+void Gate::AppendConnectionPoints(GeometryBuffer& buffer) const {
+    // Black rim, white ring, state-coloured centre - matches the layered circles in DrawConnectionPoints
+    auto appendPin = [&buffer](Vector2 pos, Color centre) {
+        buffer.AddDisc(pos, CONNECTION_POINT_RADIUS + 0.5f, BLACK);
+        buffer.AddDisc(pos, CONNECTION_POINT_RADIUS - 0.5f, WHITE);
+        buffer.AddDisc(pos, CONNECTION_POINT_RADIUS - 1, centre);
+    };
+
+    int inputCount = GetInputCount();
+    for (int i = 0; i < inputCount; i++) {
+        appendPin(GetInputPoint(i), PinColor(i, GetInputState(i) != 0));
+    }
+
+    bool drawsOutputs = type == GateType::NAND || type == GateType::NOR || type == GateType::NOT ||
+        type == GateType::INPUT || type == GateType::SUBCIRCUIT || IsClocked(type);
+    int outputCount = drawsOutputs ? GetOutputCount() : 0;
+    for (int i = 0; i < outputCount; i++) {
+        appendPin(GetOutputPoint(i), PinColor(OUTPUT_PIN_BIT + i, GetOutputState(i) != 0));
+    }
+}
+
+// Batched rendering: emit the same picture as Draw() into a geometry buffer
+void Gate::AppendGeometry(GeometryBuffer& buffer) const {
+    Rectangle body = GetBounds();
+
+    if (info.texture.id != 0 && type != GateType::INPUT && type != GateType::OUTPUT) {
+        buffer.AddSprite(body, info.atlasRect, WHITE);
+    } else {
+        buffer.AddRectangle(body, info.color);
+
+        if ((type == GateType::INPUT || type == GateType::OUTPUT) && width == 1) {
+            // Digital state from the digit sprites (bus values are text, see DrawLabelText)
+            Rectangle digit = ATLAS_DIGIT_RECTS[output ? 1 : 0];
+            Rectangle dest = {
+                position.x + (info.size.x - digit.width) / 2,
+                position.y + (info.size.y - digit.height) / 2,
+                digit.width, digit.height
+            };
+            buffer.AddSprite(dest, digit, output ? LIME : RED);
+        }
+
+        buffer.AddRectangleLines(body, 2, BLACK);
+    }
+
+    AppendConnectionPoints(buffer);
+}
+
+// Zoomed-out level of detail: a plain rectangle in the gate colour
+void Gate::AppendSimplifiedGeometry(GeometryBuffer& buffer) const {
+    Color fill = info.color;
+    if (type == GateType::INPUT || type == GateType::OUTPUT) {
+        fill = output ? LIME : info.color;  // Keep I/O state readable from afar
+    }
+    buffer.AddRectangle(GetBounds(), fill);
+}
+
+// Gates without an image show their label as text, which can't go through the atlas
+bool Gate::NeedsLabelText() const {
+    return (info.texture.id == 0 && type != GateType::INPUT && type != GateType::OUTPUT) || width > 1;
+}
+
+void Gate::DrawLabelText() const {
+    if (type == GateType::INPUT || type == GateType::OUTPUT) {
+        // Bus I/O value in hex
+        std::string valueText = FormatBusValue(output, width);
+        int valueWidth = MeasureText(valueText.c_str(), 18);
+        DrawText(valueText.c_str(), (int)(position.x + (info.size.x - valueWidth) / 2),
+            (int)(position.y + (info.size.y - 18) / 2), 18, output ? LIME : RED);
+        return;
+    }
+
+    if (width > 1) DrawWidthTag();
+    if (info.texture.id != 0) return;
+
+    int fontSize = 18;
+    int textWidth = MeasureText(info.label, fontSize);
+    Vector2 textPos = {
+        position.x + (info.size.x - textWidth) / 2,
+        position.y + (info.size.y - fontSize) / 2
+    };
+    DrawText(info.label, (int)textPos.x, (int)textPos.y, fontSize, WHITE);
 }
\ No newline at end of file
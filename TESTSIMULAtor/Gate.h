@@ -5,6 +5,7 @@
 #include "raymath.h"
 #include "Constants.h"
 #include "Wire.h"
+#include "GeometryBuffer.h"
 #include <vector>
 #include <memory>
 #include <ostream>
@@ -16,26 +17,52 @@ class Gate {
 private:
     GateType type;
     GateInfo info;
+    int definition = -1;                        // SUBCIRCUIT: id in SUBCIRCUITS
+    int width = 1;                              // Bus width of a primitive gate
     void DrawConnectionPoints() const;
+    void AppendConnectionPoints(GeometryBuffer& buffer) const;
+    void DrawWidthTag() const;
+    Color PinColor(int pinBit, bool state) const;
 
 public:
     // Gate properties
     Vector2 position;
-    bool input1 = false;
-    bool input2 = false;
-    bool output = false;
+    BusWord input1 = 0;     // Pin values, one lane per bit (see BusWord)
+    BusWord input2 = 0;
+    BusWord output = 0;
 
-    // Constructor
-    Gate(GateType t, Vector2 pos);
+    // Four-valued simulation: pins carrying X or Z on any lane, and of those the ones
+    // left floating (Z). Bit i is input i and bit OUTPUT_PIN_BIT + o is output o;
+    // pins beyond those aren't marked. Zero while simulating two-valued.
+    static const int OUTPUT_PIN_BIT = 32;
+    unsigned long long unknownPins = 0;
+    unsigned long long floatingPins = 0;
+
+    // Port values of a SUBCIRCUIT instance (its only per-instance state)
+    std::vector<BusWord> portInputs;
+    std::vector<BusWord> portOutputs;
+
+    // Constructor (definitionId is only used for GateType::SUBCIRCUIT,
+    // busWidth only for the other types)
+    Gate(GateType t, Vector2 pos, int definitionId = -1, int busWidth = 1);
+
+    // Gates are carved from a shared ObjectPool instead of one heap block each
+    // (create and delete them on the UI thread only)
+    static void* operator new(size_t size);
+    static void operator delete(void* pointer, size_t size);
+    static void ReservePool(size_t count);  // Room for count more gates up front
 
     // Getters
     GateType GetType() const;
     Vector2 GetSize() const;
     Color GetColor() const;
     const char* GetLabel() const;
+    int GetDefinition() const;
+    int GetWidth() const;
 
     // Logic computation
     void ComputeOutput();
+    void ClockEdge();   // Clocked gates load their next state (call after ComputeOutput)
 
     // Collision and boundary methods
     Rectangle GetBounds() const;
@@ -44,20 +71,52 @@ public:
 
     // Connection point helpers
     Vector2 GetInputPoint(int inputIndex = 0) const;
-    Vector2 GetOutputPoint() const;
+    Vector2 GetOutputPoint(int outputIndex = 0) const;
     int GetInputCount() const;
+    int GetOutputCount() const;
     bool HasOutput() const;
 
+    // Bus width of a pin; wires only join pins of equal width
+    int GetInputWidth(int inputIndex) const;
+    int GetOutputWidth(int outputIndex = 0) const;
+
+    // Pin values by number, for any gate type
+    BusWord GetInputState(int inputIndex) const;
+    void SetInputState(int inputIndex, BusWord value);
+    BusWord GetOutputState(int outputIndex = 0) const;
+    void SetOutputState(int outputIndex, BusWord value);    // For results computed elsewhere
+    void ResetInputs();
+
+    // Step an INPUT gate's value by delta, wrapping within its width (toggles one-bit inputs)
+    void StepInputValue(int delta);
+
+    // Pin values folded into one word, for change detection
+    unsigned long long GetStateSignature() const;
+
     // Get all connection points for this gate
-    std::vector<ConnectionPoint> GetConnectionPoints(int gateIndex) const;
+    std::vector<ConnectionPoint> GetConnectionPoints(GateHandle handle) const;
 
     // Check if an input is connected
-    bool IsInputConnected(int inputIndex, const std::vector<std::unique_ptr<Wire>>& wires) const;
+    bool IsInputConnected(int inputIndex, const WireStore& wires) const;
 
     // Rendering
     void Draw(bool preview = false, bool highlight = false) const;
+
+    // Batched rendering: emit the same picture as Draw() into a geometry buffer
+    void AppendGeometry(GeometryBuffer& buffer) const;
+
+    // Zoomed-out level of detail: a plain rectangle in the gate colour
+    void AppendSimplifiedGeometry(GeometryBuffer& buffer) const;
+
+    // Gates without an image show their label as text, which can't go through the atlas;
+    // so do bus gates (width tag, or the hex value of bus I/O)
+    bool NeedsLabelText() const;
+    void DrawLabelText() const;
 };
 
 std::ostream& operator<<(std::ostream& os, const GateType& type);
 
+// Bounds of every gate indexed by slot (empty for free slots), for routing off the live gates
+std::vector<Rectangle> SnapshotGateBounds(const GateStore& gates);
+
 #endif // GATE_H
\ No newline at end of file
@@ -0,0 +1,457 @@
+// Generated by tools/pack_atlas.py from resources/*.png - do not edit by hand.
+#ifndef GATE_ATLAS_DATA_H
+#define GATE_ATLAS_DATA_H
+
+// Atlas size in pixels
+#define GATE_ATLAS_WIDTH 512
+#define GATE_ATLAS_HEIGHT 64
+
+// Source rectangles in atlas pixels: { x, y, width, height }
+#define GATE_ATLAS_RECT_AND { 2, 2, 76, 51 }
+#define GATE_ATLAS_RECT_OR { 80, 2, 76, 51 }
+#define GATE_ATLAS_RECT_NOT { 158, 2, 70, 51 }
+#define GATE_ATLAS_RECT_NAND { 230, 2, 88, 51 }
+#define GATE_ATLAS_RECT_NOR { 320, 2, 77, 52 }
+#define GATE_ATLAS_RECT_WHITE { 401, 4, 4, 4 }
+#define GATE_ATLAS_RECT_DISC { 409, 2, 32, 32 }
+#define GATE_ATLAS_RECT_DIGIT_SLOT_0 { 443, 2, 32, 32 }
+#define GATE_ATLAS_RECT_DIGIT_SLOT_1 { 477, 2, 32, 32 }
+
+// Atlas image (PNG, 6898 bytes)
+static const int GATE_ATLAS_PNG_SIZE = 6898;
+static const unsigned char GATE_ATLAS_PNG[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x06, 0x00, 0x00, 0x00, 0x6c, 0xbf, 0xcf,
+    0xbf, 0x00, 0x00, 0x1a, 0xb9, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x5d, 0x09, 0x54, 0x94,
+    0xd7, 0xd9, 0x16, 0x0a, 0x6a, 0x24, 0x2c, 0x06, 0x82, 0xa2, 0x20, 0x58, 0x1b, 0xf7, 0x62, 0x1b,
+    0xfc, 0x4f, 0x4f, 0x70, 0x8b, 0xc6, 0x50, 0x95, 0xa8, 0xb1, 0x2d, 0x9a, 0x1c, 0x72, 0x20, 0x31,
+    0xee, 0x51, 0x92, 0xd8, 0x0a, 0x28, 0xa9, 0xa9, 0x1b, 0x1a, 0xd1, 0x98, 0xb8, 0x27, 0x2a, 0x6a,
+    0x94, 0x56, 0xa3, 0x03, 0x0c, 0x88, 0x62, 0x54, 0x54, 0x14, 0x7f, 0x98, 0x01, 0x8d, 0x91, 0x1a,
+    0x8d, 0x0b, 0x02, 0x05, 0x85, 0x19, 0x66, 0x61, 0x76, 0x18, 0x78, 0xff, 0xf7, 0xc2, 0xf8, 0x87,
+    0x1a, 0x17, 0x96, 0xf9, 0x66, 0xf9, 0xe6, 0x7d, 0xce, 0x79, 0xce, 0x8c, 0x23, 0x0c, 0xdf, 0xf7,
+    0xcc, 0xdc, 0xfb, 0x3e, 0xef, 0xbd, 0xef, 0xbd, 0xb7, 0x53, 0x27, 0x02, 0x81, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x8e, 0x05, 0x30, 0xb1, 0xd1, 0xc9, 0xc9, 0xa9,
+    0xc1, 0xd9, 0xd9, 0xd9, 0xf8, 0xab, 0x5f, 0xfd, 0xaa, 0xde, 0xd5, 0xd5, 0xd5, 0xd0, 0xa5, 0x4b,
+    0x17, 0x5d, 0xd7, 0xae, 0x5d, 0xd5, 0x6e, 0x6e, 0x6e, 0xca, 0xe7, 0x9f, 0x7f, 0x5e, 0xea, 0xe1,
+    0xe1, 0x71, 0xdf, 0xcb, 0xcb, 0xab, 0xf4, 0x85, 0x17, 0x5e, 0xf8, 0xc9, 0xdb, 0xdb, 0xfb, 0x07,
+    0x1f, 0x1f, 0x9f, 0x7c, 0xe4, 0x19, 0x7c, 0x9e, 0x8e, 0xff, 0xb7, 0xef, 0xb9, 0xe7, 0x9e, 0xdb,
+    0x84, 0xef, 0xf3, 0x09, 0x32, 0x06, 0x19, 0x8d, 0x9c, 0x82, 0x1c, 0x85, 0x1c, 0x82, 0xec, 0x89,
+    0x74, 0xe1, 0xbb, 0x6e, 0x2e, 0x2e, 0x2e, 0xfa, 0xce, 0x9d, 0x3b, 0x6b, 0x51, 0x3b, 0x15, 0xea,
+    0x21, 0x47, 0xed, 0x24, 0xee, 0xee, 0xee, 0x95, 0x9e, 0x9e, 0x9e, 0xf7, 0x98, 0x6e, 0x2f, 0xbe,
+    0xf8, 0xe2, 0xb5, 0x9e, 0x3d, 0x7b, 0x8a, 0xfd, 0xfc, 0xfc, 0xce, 0xe3, 0xf3, 0x0c, 0xa6, 0x1b,
+    0xfe, 0xce, 0x06, 0x47, 0xd1, 0xed, 0xa5, 0x97, 0x5e, 0x2a, 0xc1, 0xfb, 0x3e, 0x81, 0x4f, 0xff,
+    0x4c, 0x4d, 0xef, 0x97, 0xc8, 0x10, 0x03, 0x98, 0xd8, 0x68, 0x62, 0x83, 0x50, 0x0c, 0x46, 0x7c,
+    0xac, 0x4f, 0x17, 0x81, 0x41, 0x28, 0x02, 0x5d, 0x9a, 0x08, 0x34, 0x69, 0x05, 0x50, 0x8b, 0x94,
+    0xa7, 0x8a, 0xa1, 0x3a, 0xb5, 0x00, 0x2a, 0x91, 0xf7, 0x52, 0x45, 0xf0, 0x93, 0x40, 0x04, 0xd7,
+    0x04, 0x05, 0x20, 0xc6, 0x7f, 0xe7, 0xe2, 0xf3, 0x13, 0x47, 0xf3, 0xe1, 0x28, 0xbe, 0x9e, 0x8c,
+    0xbf, 0xb3, 0x29, 0xa3, 0x10, 0x96, 0x67, 0x16, 0xc2, 0xe2, 0x4c, 0x11, 0xcc, 0xce, 0x2c, 0x82,
+    0x19, 0xf8, 0x9e, 0x13, 0xf1, 0x3d, 0x43, 0xd3, 0x2f, 0xc3, 0x60, 0xe1, 0x45, 0xe8, 0xf5, 0xed,
+    0x25, 0x78, 0xce, 0x61, 0x3a, 0xbd, 0x9f, 0xd1, 0x88, 0x68, 0x40, 0x18, 0x11, 0x75, 0xf5, 0xf5,
+    0xf5, 0x7a, 0x83, 0xc1, 0xa0, 0xd5, 0xeb, 0xf5, 0xb5, 0x5a, 0xad, 0x56, 0xae, 0xd1, 0x68, 0xaa,
+    0x55, 0x2a, 0x55, 0x85, 0x42, 0xa1, 0x28, 0x91, 0xc9, 0x64, 0x37, 0x24, 0x12, 0xc9, 0xd5, 0x07,
+    0x0f, 0x1e, 0x14, 0x20, 0x73, 0x6a, 0x6a, 0x6a, 0x52, 0xd5, 0x6a, 0xf5, 0x6e, 0x7c, 0x8f, 0x75,
+    0xc8, 0x65, 0xc8, 0x0f, 0x90, 0xef, 0x20, 0xc3, 0x91, 0xa1, 0xc8, 0x81, 0x48, 0x1f, 0x1e, 0x6b,
+    0xf7, 0x58, 0xb4, 0xf8, 0xb9, 0xd6, 0xd2, 0x1d, 0x19, 0x89, 0xdc, 0x85, 0xc4, 0x6f, 0x3f, 0x48,
+    0x91, 0x46, 0x13, 0xa5, 0xa6, 0xd7, 0x76, 0x99, 0x7e, 0xc6, 0xbd, 0xb5, 0xef, 0x4b, 0x68, 0xc7,
+    0xe7, 0x89, 0x0d, 0x01, 0xea, 0xea, 0xea, 0x40, 0xa7, 0xd3, 0x01, 0x7e, 0xf1, 0x01, 0xbf, 0xf4,
+    0x50, 0x55, 0x55, 0x05, 0xe5, 0xe5, 0xe5, 0x70, 0xfb, 0xf6, 0x6d, 0x28, 0x2e, 0x2e, 0x86, 0xc2,
+    0xc2, 0x42, 0xb8, 0x70, 0xe1, 0x02, 0x9c, 0x3c, 0x79, 0x12, 0xd2, 0xd2, 0xd2, 0xe0, 0xc0, 0x81,
+    0x03, 0xb0, 0x63, 0xc7, 0x0e, 0x58, 0xbf, 0x7e, 0x3d, 0x24, 0x24, 0x24, 0x34, 0xcc, 0x9b, 0x37,
+    0x4f, 0x17, 0x11, 0x11, 0xa1, 0x1a, 0x37, 0x6e, 0x9c, 0x22, 0x38, 0x38, 0x58, 0xee, 0xef, 0xef,
+    0xcf, 0x0c, 0x84, 0x96, 0xfd, 0x2d, 0x0c, 0x8a, 0xb5, 0xcc, 0x44, 0xa0, 0x71, 0x10, 0x63, 0x40,
+    0x4c, 0xc5, 0x40, 0xc9, 0x82, 0xdf, 0x42, 0xe4, 0x9b, 0xc8, 0x97, 0x91, 0xde, 0x76, 0xa2, 0xdb,
+    0x20, 0x5f, 0x5f, 0xdf, 0xa2, 0xb0, 0xb0, 0x30, 0x6d, 0x49, 0x49, 0x49, 0x87, 0x75, 0x8b, 0x8f,
+    0x8f, 0xd7, 0xcf, 0x9e, 0x3d, 0x5b, 0x39, 0x6d, 0xda, 0xb4, 0x9a, 0x51, 0xa3, 0x46, 0x55, 0x0f,
+    0x1e, 0x3c, 0x58, 0xd2, 0xab, 0x57, 0x2f, 0x66, 0x20, 0x34, 0x4c, 0x37, 0x34, 0x62, 0x4a, 0x66,
+    0x22, 0xd0, 0x6c, 0x89, 0xd0, 0x50, 0x1c, 0xc1, 0xd7, 0xd6, 0xd9, 0xa3, 0x6e, 0x68, 0x92, 0x8c,
+    0x7b, 0xf6, 0xec, 0x81, 0x91, 0x23, 0x47, 0xca, 0xf0, 0xbb, 0xa0, 0xee, 0xde, 0xbd, 0xfb, 0x37,
+    0xf8, 0xf2, 0x6b, 0xd4, 0x0c, 0x7f, 0x36, 0x00, 0x8b, 0x32, 0x7e, 0x66, 0x8c, 0x89, 0x1f, 0x66,
+    0x02, 0x7c, 0x64, 0xe2, 0xc7, 0xc7, 0x00, 0x16, 0x23, 0xff, 0x96, 0x05, 0xb0, 0x04, 0x1f, 0xe3,
+    0xf0, 0x71, 0xe9, 0x71, 0x80, 0x84, 0x13, 0x00, 0x7f, 0xcf, 0x06, 0xf8, 0xf4, 0x24, 0xc0, 0xca,
+    0xef, 0x00, 0x56, 0x23, 0x13, 0x4f, 0x03, 0xac, 0x47, 0x6e, 0x3c, 0x03, 0xb0, 0x29, 0x07, 0x60,
+    0xeb, 0x39, 0x30, 0x7c, 0x75, 0x1e, 0xd4, 0xc9, 0x17, 0x41, 0xf9, 0x4d, 0x1e, 0xc8, 0xff, 0x99,
+    0x0f, 0xf2, 0x6f, 0xf3, 0x41, 0x89, 0x86, 0x41, 0x9b, 0x8e, 0x66, 0x03, 0x0d, 0x81, 0x9e, 0x99,
+    0x0a, 0x34, 0x11, 0x3f, 0x21, 0xf3, 0x98, 0x81, 0x40, 0x03, 0xb2, 0x11, 0xaf, 0xeb, 0x63, 0xe4,
+    0xdb, 0x69, 0x62, 0x78, 0x35, 0xf3, 0x0a, 0xbc, 0x84, 0x46, 0xa2, 0x9b, 0x9d, 0x77, 0x7a, 0xaf,
+    0x61, 0x00, 0xaf, 0xdc, 0xbb, 0x77, 0x2f, 0xa0, 0x21, 0x07, 0x34, 0xa5, 0xd0, 0xa3, 0x47, 0x0f,
+    0xc0, 0x36, 0x07, 0x7d, 0xfa, 0xf4, 0x81, 0x7e, 0xfd, 0xfa, 0xc1, 0x80, 0x01, 0x03, 0x00, 0xfb,
+    0x2f, 0x08, 0x09, 0x09, 0x81, 0x11, 0x23, 0x46, 0x00, 0xf6, 0x67, 0xf0, 0xc6, 0x1b, 0x6f, 0x00,
+    0xf6, 0x6d, 0x10, 0x15, 0x15, 0x05, 0xf3, 0xe7, 0xcf, 0x87, 0x25, 0x4b, 0x96, 0xc0, 0xca, 0x95,
+    0x2b, 0x61, 0xcb, 0x96, 0x2d, 0xda, 0x94, 0x94, 0x14, 0x45, 0x76, 0x76, 0xb6, 0x54, 0x2c, 0x16,
+    0x57, 0xdf, 0xba, 0x75, 0x4b, 0x52, 0x5d, 0x5d, 0x2d, 0x47, 0x23, 0xa1, 0x65, 0xee, 0x02, 0xcd,
+    0x84, 0x0c, 0x4d, 0xc4, 0x6d, 0xec, 0x17, 0x2e, 0xe2, 0xf3, 0x03, 0xf8, 0xf7, 0x57, 0x21, 0xe7,
+    0x22, 0x27, 0x21, 0x87, 0xb2, 0xc0, 0xe6, 0x80, 0x06, 0x60, 0xa8, 0x29, 0xb0, 0x1b, 0xa1, 0xf5,
+    0x30, 0x9a, 0x7e, 0x67, 0x28, 0x19, 0x00, 0xcb, 0x7c, 0x9e, 0x66, 0x05, 0x3a, 0x68, 0xb8, 0x76,
+    0xed, 0x1a, 0x9c, 0x3a, 0x75, 0x0a, 0xf6, 0xef, 0xdf, 0x0f, 0x89, 0x89, 0x89, 0x80, 0x81, 0x4f,
+    0xcb, 0xcc, 0x42, 0xdf, 0xbe, 0x7d, 0x15, 0x18, 0xe8, 0x0c, 0x6c, 0xd4, 0x01, 0xcd, 0xc1, 0x0d,
+    0x0c, 0x76, 0x19, 0x78, 0x7d, 0x9f, 0x22, 0xdf, 0x42, 0xfe, 0x0e, 0xe9, 0x6a, 0x6b, 0xe2, 0xe1,
+    0x35, 0xae, 0x41, 0x73, 0x63, 0x38, 0x74, 0xe8, 0x90, 0x45, 0x75, 0x5b, 0xbd, 0x7a, 0x75, 0x7d,
+    0x74, 0x74, 0xb4, 0x0c, 0x03, 0x69, 0x55, 0x40, 0x40, 0x80, 0x14, 0x8d, 0x94, 0x9e, 0x8d, 0x3a,
+    0x78, 0x78, 0x78, 0xfc, 0x1b, 0xaf, 0x47, 0x60, 0xab, 0xba, 0x31, 0x03, 0xf0, 0xf0, 0x9e, 0x4a,
+    0x4b, 0x4b, 0x61, 0xc3, 0x86, 0x0d, 0x30, 0x64, 0xc8, 0x10, 0x39, 0x5e, 0xf7, 0x03, 0xbc, 0xfe,
+    0xf5, 0x26, 0x33, 0x43, 0x06, 0xc0, 0x4a, 0x64, 0x06, 0x23, 0x36, 0xab, 0xd9, 0x4c, 0xac, 0x40,
+    0x23, 0xb1, 0xf6, 0x14, 0x9a, 0x07, 0x34, 0x0e, 0xdb, 0xce, 0x81, 0x7e, 0x0f, 0x9a, 0x86, 0x94,
+    0x4b, 0x20, 0x3f, 0x5a, 0x00, 0xb5, 0x42, 0x11, 0x18, 0xd1, 0x2c, 0x30, 0xe3, 0x70, 0x53, 0x20,
+    0x82, 0x6c, 0x36, 0xc2, 0x80, 0xaf, 0xcd, 0x47, 0x63, 0x10, 0x76, 0x4c, 0x0c, 0xbf, 0xb6, 0x93,
+    0x8e, 0xcf, 0x09, 0xbf, 0x83, 0x47, 0xd1, 0xa0, 0x6b, 0xc3, 0xc3, 0xc3, 0x01, 0xfb, 0x1c, 0x4e,
+    0x88, 0xc9, 0x0e, 0x0c, 0x1c, 0x38, 0x10, 0xc6, 0x8c, 0x19, 0x03, 0xd3, 0xa7, 0x4f, 0x87, 0x98,
+    0x98, 0x18, 0x48, 0x4a, 0x4a, 0xd2, 0x09, 0x04, 0x02, 0x69, 0x51, 0x51, 0x11, 0xe6, 0x09, 0x55,
+    0x35, 0xf5, 0x6c, 0xe8, 0x41, 0xaf, 0x97, 0x61, 0xf2, 0x70, 0x19, 0x0d, 0xc2, 0x41, 0xbc, 0xb6,
+    0x78, 0xe4, 0x34, 0x36, 0x8a, 0xc0, 0x53, 0x03, 0x90, 0x64, 0x86, 0x6e, 0x31, 0x89, 0x0c, 0x80,
+    0x9d, 0x19, 0x80, 0xd6, 0x40, 0x2a, 0x95, 0x42, 0x7e, 0x7e, 0x7e, 0x53, 0x86, 0x9c, 0x90, 0x90,
+    0xd0, 0x38, 0x69, 0xd2, 0x24, 0x25, 0xba, 0x72, 0xa5, 0x93, 0x93, 0x53, 0x23, 0x66, 0x8c, 0x25,
+    0x18, 0x74, 0x53, 0xf1, 0xba, 0x3f, 0x42, 0x8e, 0x46, 0xda, 0xc2, 0xb0, 0xe5, 0x38, 0x2f, 0x2f,
+    0x2f, 0x49, 0x5c, 0x5c, 0x9c, 0xcd, 0xe8, 0xb6, 0x6c, 0xd9, 0xb2, 0x7a, 0xec, 0xd4, 0x6a, 0x03,
+    0x03, 0x03, 0x6b, 0x99, 0x6e, 0xee, 0xee, 0xee, 0xb7, 0x5c, 0x5d, 0x5d, 0x0f, 0x5a, 0x5b, 0xb7,
+    0x96, 0x06, 0xa0, 0x25, 0xbe, 0xff, 0xfe, 0x7b, 0x76, 0xcd, 0x46, 0xcc, 0xc0, 0x94, 0xf8, 0xf9,
+    0xfe, 0x84, 0x3f, 0xba, 0x04, 0xd9, 0x97, 0x0c, 0x80, 0xed, 0x92, 0x8d, 0x40, 0x24, 0x64, 0x37,
+    0x8f, 0x34, 0x30, 0x93, 0xb0, 0x33, 0x17, 0x34, 0x07, 0xf2, 0x40, 0x2e, 0x28, 0x00, 0xb5, 0x50,
+    0x0c, 0x75, 0x68, 0x14, 0xee, 0xa2, 0x41, 0xc8, 0x14, 0x16, 0xc2, 0x27, 0xe9, 0x05, 0x30, 0x4d,
+    0x78, 0x09, 0x7e, 0x63, 0x8b, 0x9a, 0xeb, 0x74, 0xba, 0x77, 0x59, 0x00, 0x66, 0xed, 0x97, 0x2b,
+    0x13, 0xd0, 0x1a, 0x0e, 0x1a, 0x34, 0x08, 0x98, 0x11, 0x61, 0x06, 0x61, 0xfb, 0xf6, 0xed, 0xfa,
+    0xdc, 0xdc, 0x5c, 0x25, 0x9a, 0x03, 0x15, 0x5e, 0x9a, 0x01, 0x8d, 0xc1, 0x35, 0x6c, 0x26, 0x3b,
+    0x4d, 0xa3, 0x06, 0xc3, 0xed, 0xd8, 0x00, 0x0c, 0x35, 0x0d, 0xe9, 0x9b, 0x0b, 0xe2, 0x27, 0x8d,
+    0x06, 0x10, 0xec, 0xd4, 0x00, 0x3c, 0x09, 0x6c, 0x98, 0xfd, 0xf2, 0xe5, 0xcb, 0xc0, 0x86, 0x90,
+    0xe7, 0xcc, 0x99, 0xa3, 0xc5, 0x06, 0xa3, 0x60, 0xd7, 0x8f, 0x01, 0xe3, 0xc7, 0x6e, 0xdd, 0xba,
+    0x6d, 0x36, 0x0d, 0x87, 0x77, 0xb7, 0x92, 0x8e, 0x1e, 0x18, 0xbc, 0xce, 0xa3, 0xcb, 0x97, 0xb1,
+    0x6c, 0xdd, 0x56, 0x75, 0x8b, 0x8c, 0x8c, 0xac, 0x0c, 0x0a, 0x0a, 0xaa, 0x64, 0xba, 0xa1, 0x66,
+    0x57, 0xf0, 0x71, 0x83, 0x25, 0x75, 0x7b, 0x92, 0x01, 0x68, 0x89, 0xb3, 0x67, 0xcf, 0xb2, 0x51,
+    0x21, 0x0d, 0x9a, 0x16, 0x2d, 0x66, 0x4f, 0x05, 0xf8, 0x6b, 0xb3, 0x90, 0x5e, 0x64, 0x00, 0xec,
+    0x87, 0x6c, 0xca, 0x82, 0x8d, 0x22, 0x24, 0x9e, 0x02, 0xd8, 0x7c, 0x16, 0xea, 0xf7, 0x5f, 0x00,
+    0x05, 0x33, 0x06, 0xe9, 0x62, 0x50, 0xe3, 0xa3, 0x28, 0x5d, 0x04, 0x49, 0x78, 0xaf, 0x7f, 0x3e,
+    0x7e, 0x15, 0xfc, 0x6d, 0xa4, 0x13, 0x1c, 0x82, 0xc1, 0xf6, 0xce, 0xfe, 0xfd, 0xfb, 0xf5, 0xd6,
+    0x34, 0x01, 0x8f, 0xa3, 0xbf, 0xbf, 0x3f, 0x4c, 0x98, 0x30, 0x81, 0x4d, 0x13, 0x1a, 0xb2, 0xb2,
+    0xb2, 0x2a, 0x1f, 0x3c, 0x78, 0x50, 0x65, 0x34, 0x1a, 0xf5, 0x1a, 0x8d, 0x26, 0x0f, 0xaf, 0x7b,
+    0x05, 0xf2, 0x75, 0x64, 0x67, 0x3b, 0x30, 0x00, 0x23, 0x4d, 0x73, 0xfa, 0x66, 0xcf, 0x7d, 0x4c,
+    0xef, 0x4d, 0x06, 0x80, 0xcf, 0x06, 0xe0, 0xb1, 0x13, 0x42, 0x46, 0x23, 0xa0, 0x53, 0x86, 0x35,
+    0x6b, 0xd6, 0xb0, 0x79, 0x3a, 0x39, 0x06, 0x98, 0x06, 0x0c, 0x1a, 0x57, 0xf1, 0xbe, 0x12, 0x90,
+    0x21, 0x96, 0x16, 0xd3, 0xcd, 0xcd, 0x2d, 0x09, 0x8d, 0x80, 0x8c, 0xcd, 0xf7, 0xdb, 0x83, 0x6e,
+    0x09, 0x09, 0x09, 0x92, 0x90, 0x90, 0x90, 0x4a, 0x56, 0xc4, 0x88, 0xd7, 0x2e, 0xe2, 0x5a, 0xb7,
+    0xd6, 0x18, 0x80, 0x96, 0x48, 0x4d, 0x4d, 0x85, 0x37, 0xdf, 0x7c, 0x53, 0xc9, 0x3e, 0x57, 0x47,
+    0x28, 0x1e, 0xe4, 0x8b, 0x01, 0x78, 0x12, 0xff, 0x7a, 0x0c, 0xe0, 0x1f, 0x27, 0x9b, 0xeb, 0x11,
+    0xf6, 0xe5, 0x81, 0x22, 0xbd, 0xb9, 0xa8, 0xb1, 0x22, 0x55, 0x04, 0xff, 0xca, 0x14, 0x43, 0x54,
+    0x46, 0x21, 0xf4, 0xb1, 0xa6, 0xfe, 0xf7, 0xef, 0xdf, 0x3f, 0x86, 0x6d, 0x57, 0xda, 0xbf, 0x7f,
+    0x7f, 0xb0, 0x35, 0x23, 0xd0, 0x92, 0xac, 0x4e, 0x81, 0xd5, 0x22, 0xec, 0xdc, 0xb9, 0x53, 0x72,
+    0xf3, 0xe6, 0xcd, 0x6a, 0x6c, 0xcf, 0xf5, 0x2a, 0x95, 0xea, 0x2c, 0x36, 0x99, 0x18, 0x64, 0x7f,
+    0x1b, 0x34, 0x00, 0x43, 0x39, 0x0a, 0xfe, 0x2d, 0x4d, 0xc0, 0x50, 0x32, 0x00, 0x0e, 0x66, 0x00,
+    0x1e, 0x07, 0x56, 0x64, 0xb7, 0x68, 0xd1, 0x22, 0xbd, 0x9f, 0x9f, 0x1f, 0x2b, 0x38, 0xac, 0xe8,
+    0xdc, 0xb9, 0xf3, 0x67, 0x16, 0x36, 0x03, 0xb3, 0xba, 0x74, 0xe9, 0x62, 0x38, 0x7e, 0xfc, 0xb8,
+    0xdd, 0xe9, 0x16, 0x15, 0x15, 0xc5, 0x56, 0x79, 0x48, 0xba, 0x76, 0xed, 0x7a, 0x17, 0xef, 0x23,
+    0xd1, 0xdc, 0xba, 0xb5, 0xd5, 0x00, 0x3c, 0x44, 0x6d, 0x6d, 0x2d, 0x3c, 0xa6, 0x78, 0x70, 0x1c,
+    0x19, 0x00, 0xfb, 0x67, 0xfc, 0xf1, 0xe6, 0x42, 0xc5, 0xe4, 0x0b, 0xa0, 0x64, 0x86, 0x40, 0x20,
+    0x82, 0xdb, 0xe9, 0x05, 0xb0, 0x5e, 0x28, 0x82, 0xd1, 0x56, 0xea, 0x10, 0x57, 0x95, 0x95, 0x95,
+    0x29, 0x42, 0x43, 0x43, 0x6d, 0xda, 0x04, 0xb4, 0x64, 0x40, 0x40, 0x00, 0x44, 0x47, 0x47, 0x43,
+    0x56, 0x56, 0x56, 0xb9, 0x56, 0xab, 0x65, 0x2b, 0x18, 0xbe, 0xc7, 0xfb, 0x60, 0x73, 0x92, 0xfd,
+    0x6c, 0xc4, 0x00, 0x88, 0x2d, 0xd0, 0x85, 0x89, 0xc9, 0x00, 0x90, 0x01, 0xf8, 0x2f, 0xb0, 0x4c,
+    0x3c, 0x36, 0x36, 0xb6, 0xde, 0xd7, 0xd7, 0x57, 0xe5, 0xed, 0xed, 0x7d, 0x1d, 0xef, 0x77, 0xbe,
+    0x85, 0xe6, 0xbf, 0x27, 0xb3, 0xac, 0x95, 0xeb, 0xe2, 0x40, 0x2e, 0x75, 0x9b, 0x3b, 0x77, 0x6e,
+    0x19, 0x06, 0x5a, 0x99, 0xa7, 0xa7, 0xe7, 0x0f, 0xe6, 0xd2, 0xad, 0xbd, 0x06, 0xa0, 0x25, 0x5a,
+    0x16, 0x0f, 0xe2, 0xb5, 0xf1, 0xaa, 0x78, 0xd0, 0x11, 0x0d, 0xc0, 0xa3, 0xfc, 0x24, 0x1b, 0xe0,
+    0x8b, 0x1c, 0x68, 0x38, 0x94, 0x0f, 0x8a, 0x34, 0x11, 0x48, 0xd3, 0xc5, 0xb0, 0xe3, 0x58, 0x11,
+    0x8c, 0xb2, 0x70, 0xa7, 0xb8, 0x50, 0x26, 0x93, 0x69, 0xc3, 0xc2, 0xc2, 0xec, 0xc6, 0x04, 0xb4,
+    0xe4, 0xd4, 0xa9, 0x53, 0x41, 0x28, 0x14, 0x96, 0x1a, 0x0c, 0x06, 0x8d, 0x4a, 0xa5, 0x3a, 0x87,
+    0xf7, 0xf3, 0x96, 0x15, 0x0d, 0x40, 0x92, 0x05, 0xbb, 0xae, 0x24, 0x32, 0x00, 0x64, 0x00, 0x1e,
+    0x0b, 0x96, 0x91, 0x87, 0x87, 0x87, 0x2b, 0xd9, 0xfe, 0x06, 0xa6, 0xe5, 0x87, 0x01, 0x1c, 0x6b,
+    0x3b, 0x9a, 0x55, 0xe7, 0x1f, 0x3c, 0x78, 0xd0, 0xee, 0x75, 0x9b, 0x30, 0x61, 0x42, 0x0d, 0xdb,
+    0xdf, 0xa0, 0x53, 0xf3, 0xf2, 0xc3, 0x00, 0x6b, 0x1a, 0x00, 0x3e, 0x17, 0x0f, 0x92, 0x01, 0xf8,
+    0xe5, 0xe8, 0x00, 0x9b, 0x2e, 0x38, 0x9c, 0x0f, 0x4a, 0x41, 0x01, 0xdc, 0xcb, 0x14, 0xc3, 0x92,
+    0xd4, 0x3c, 0xf0, 0xb5, 0x50, 0xc7, 0x18, 0xa5, 0x56, 0xab, 0x0d, 0x13, 0x27, 0x4e, 0xb4, 0x4b,
+    0x13, 0xf0, 0x90, 0x73, 0xe6, 0xcc, 0x81, 0x2b, 0x57, 0xae, 0x48, 0x34, 0x1a, 0xcd, 0x7d, 0xbc,
+    0xa7, 0x25, 0xc8, 0xe7, 0x2c, 0xa4, 0xdf, 0xc3, 0xa1, 0x7f, 0x4b, 0x63, 0x28, 0x19, 0x00, 0x32,
+    0x00, 0x4f, 0xc4, 0x9d, 0x3b, 0x77, 0x60, 0xe1, 0xc2, 0x85, 0xfa, 0x4e, 0xcd, 0xfb, 0x12, 0x7c,
+    0xd1, 0x89, 0xdb, 0x35, 0xf4, 0xa1, 0x6c, 0x3a, 0xe0, 0xc8, 0x91, 0x23, 0xbc, 0xd0, 0x6d, 0xe6,
+    0xcc, 0x99, 0x55, 0x9d, 0x9a, 0x37, 0x40, 0x4a, 0x6a, 0x8f, 0x6e, 0xe6, 0x36, 0x00, 0x7c, 0x2b,
+    0x1e, 0x24, 0x03, 0xf0, 0x64, 0x2e, 0x3f, 0x01, 0xf0, 0x75, 0x2e, 0xa8, 0xd8, 0x06, 0x49, 0x69,
+    0x85, 0xb0, 0xf7, 0x98, 0x18, 0x86, 0x5a, 0xa0, 0x73, 0x8c, 0xc4, 0x0c, 0x5a, 0x3f, 0x76, 0xec,
+    0x58, 0xbb, 0x36, 0x01, 0x8c, 0xe3, 0xc7, 0x8f, 0x87, 0x33, 0x67, 0xce, 0x94, 0x1b, 0x0c, 0x06,
+    0x05, 0xde, 0x57, 0xac, 0x85, 0x0c, 0xc0, 0x2e, 0x2b, 0x74, 0x55, 0xbb, 0xc8, 0x00, 0x90, 0x01,
+    0x78, 0x26, 0x2a, 0x2b, 0x2b, 0x81, 0x6d, 0x5a, 0x84, 0x01, 0x9a, 0x6d, 0xb6, 0xb3, 0x88, 0x43,
+    0x8d, 0xc7, 0x32, 0x9d, 0x73, 0x72, 0x72, 0x78, 0xa3, 0x5b, 0x74, 0x74, 0x74, 0x55, 0x7b, 0x74,
+    0xe3, 0xd2, 0x00, 0xf0, 0xa1, 0x78, 0x90, 0x0c, 0xc0, 0xb3, 0xc9, 0x36, 0x41, 0xda, 0x74, 0x16,
+    0x80, 0x6d, 0x5a, 0x94, 0x26, 0x82, 0x43, 0x42, 0x31, 0x0c, 0xe0, 0xb8, 0x83, 0x9c, 0x55, 0x55,
+    0x55, 0xa5, 0x1e, 0x36, 0x6c, 0x98, 0xdd, 0x9b, 0x00, 0xc6, 0xd1, 0xa3, 0x47, 0xc3, 0xf9, 0xf3,
+    0xe7, 0x2b, 0xd0, 0xd8, 0x94, 0xe3, 0xbd, 0x45, 0x70, 0xa8, 0x1b, 0xdb, 0xb5, 0xcf, 0x68, 0x85,
+    0x2e, 0x8a, 0xfd, 0x4d, 0x77, 0x0a, 0xed, 0x64, 0x00, 0x5a, 0x85, 0xa2, 0xa2, 0x22, 0x78, 0xe5,
+    0x95, 0x57, 0xe4, 0x6c, 0x6b, 0x63, 0xd4, 0x83, 0xab, 0x8d, 0x37, 0x22, 0x3c, 0x3c, 0x3c, 0x54,
+    0x2c, 0x8b, 0xe6, 0x93, 0x6e, 0xa1, 0xa1, 0xa1, 0xca, 0xc0, 0xc0, 0xc0, 0xab, 0xad, 0xd5, 0xcd,
+    0x52, 0x06, 0xc0, 0x5e, 0x8b, 0x07, 0xc9, 0x00, 0xb4, 0x6d, 0xa9, 0xe1, 0x17, 0xe8, 0xa9, 0x85,
+    0x6c, 0xbb, 0x64, 0x11, 0x24, 0x72, 0xdc, 0x49, 0xc6, 0x5f, 0xbf, 0x7e, 0x5d, 0xca, 0x07, 0x03,
+    0xf0, 0x90, 0x33, 0x66, 0xcc, 0x80, 0x7b, 0xf7, 0xee, 0xd5, 0x56, 0x54, 0x54, 0x08, 0xb9, 0x08,
+    0x98, 0xd0, 0xbc, 0x75, 0xaf, 0xb5, 0x10, 0x49, 0xa1, 0x9d, 0x0c, 0x40, 0x9b, 0xc0, 0x0a, 0xcb,
+    0x5c, 0x5d, 0x5d, 0xd9, 0xd4, 0xc0, 0x0c, 0x2e, 0x84, 0x76, 0x76, 0x76, 0x8e, 0x1b, 0x3e, 0x7c,
+    0xb8, 0xc2, 0x91, 0x75, 0xb3, 0xb4, 0x01, 0x68, 0x45, 0xf1, 0xe0, 0xef, 0xc9, 0x00, 0xd8, 0x37,
+    0xd9, 0x86, 0x44, 0xbb, 0x2f, 0x40, 0xad, 0x40, 0x04, 0xa5, 0x68, 0x06, 0x5e, 0xe7, 0xea, 0xb3,
+    0xc1, 0x40, 0x99, 0x9a, 0x92, 0x92, 0x52, 0xc7, 0x27, 0x13, 0xc0, 0x98, 0x9c, 0x9c, 0x5c, 0xab,
+    0x56, 0xab, 0xcb, 0xb0, 0x89, 0x8c, 0x30, 0x73, 0x60, 0xd9, 0x65, 0xc5, 0x6e, 0x69, 0x17, 0x85,
+    0x76, 0x32, 0x00, 0xed, 0x9a, 0x47, 0xc6, 0x46, 0xa1, 0x46, 0x5d, 0xfe, 0xca, 0x85, 0xd8, 0x41,
+    0x41, 0x41, 0x39, 0xb1, 0xb1, 0xb1, 0xbc, 0xd4, 0x0d, 0x83, 0xaa, 0xf2, 0x59, 0xba, 0x59, 0xd3,
+    0x00, 0x3c, 0x5a, 0x3c, 0xb8, 0x74, 0xe9, 0x52, 0x9b, 0x2b, 0x1e, 0x24, 0x03, 0xd0, 0x7e, 0xae,
+    0xf9, 0xae, 0x69, 0x5a, 0x40, 0x97, 0x21, 0x82, 0x78, 0xae, 0x3e, 0x9f, 0xca, 0xca, 0xca, 0xf2,
+    0x0f, 0x3f, 0xfc, 0x10, 0xf8, 0x66, 0x02, 0x16, 0x2c, 0x58, 0x50, 0xc7, 0x4e, 0x45, 0xc2, 0xa6,
+    0xf1, 0x17, 0x33, 0x06, 0x16, 0xb1, 0x15, 0x9b, 0xb8, 0x98, 0x42, 0x3b, 0x19, 0x80, 0x76, 0x17,
+    0xbb, 0x61, 0xa0, 0x66, 0xbb, 0x0c, 0xc6, 0x71, 0xa0, 0x77, 0x77, 0x0c, 0x94, 0x2a, 0xb6, 0xa7,
+    0x3f, 0x1f, 0x75, 0xf3, 0xf7, 0xf7, 0x97, 0x3e, 0x4d, 0x37, 0x5b, 0x31, 0x00, 0xb6, 0x5a, 0x3c,
+    0x48, 0x06, 0xa0, 0x63, 0x64, 0xe7, 0x18, 0xa4, 0xe4, 0x81, 0x3c, 0x55, 0x04, 0xfb, 0x38, 0xea,
+    0x2c, 0xff, 0xa0, 0xd3, 0xe9, 0xea, 0x7f, 0xfb, 0xdb, 0xdf, 0xf2, 0xce, 0x04, 0xb0, 0xa5, 0x83,
+    0x75, 0x75, 0x75, 0x7a, 0xbc, 0xc7, 0xe9, 0x66, 0xd2, 0x4a, 0x6a, 0xc5, 0x66, 0x2d, 0xa5, 0xd0,
+    0x4e, 0x06, 0xa0, 0x43, 0xc3, 0xc5, 0x3d, 0x7b, 0xf6, 0xac, 0x45, 0x7d, 0x66, 0x9a, 0x5b, 0x70,
+    0x2f, 0x2f, 0xaf, 0xf7, 0x82, 0x83, 0x83, 0xd5, 0x7c, 0xd5, 0xcd, 0xcf, 0xcf, 0x4f, 0xf5, 0x24,
+    0xdd, 0x6c, 0xd1, 0x00, 0xd8, 0x52, 0xf1, 0x20, 0x19, 0x00, 0xf3, 0x30, 0x39, 0x0f, 0x14, 0x82,
+    0x7c, 0x38, 0xc2, 0xc5, 0x67, 0x54, 0x5c, 0x5c, 0xbc, 0xf7, 0xf0, 0xe1, 0xc3, 0x8d, 0x7c, 0x33,
+    0x00, 0x8c, 0x93, 0x27, 0x4f, 0x06, 0xd3, 0x48, 0xc0, 0x68, 0x33, 0x04, 0x16, 0x6b, 0xb6, 0x75,
+    0x23, 0x85, 0x76, 0x32, 0x00, 0x1d, 0x82, 0x48, 0x24, 0x62, 0x6b, 0x49, 0x80, 0x8b, 0x79, 0xe2,
+    0xde, 0xbd, 0x7b, 0x17, 0x7d, 0xf5, 0xd5, 0x57, 0x0e, 0xa7, 0x9b, 0xad, 0x1b, 0x00, 0x6b, 0x17,
+    0x0f, 0x92, 0x01, 0x30, 0x1f, 0xd9, 0x56, 0xc3, 0xa9, 0x22, 0xf8, 0x92, 0x8b, 0xcf, 0x49, 0xa1,
+    0x50, 0xc8, 0xd9, 0xd1, 0xc0, 0x7c, 0x34, 0x01, 0x73, 0xe6, 0xcc, 0x31, 0xea, 0x74, 0x3a, 0x56,
+    0x13, 0xe0, 0x46, 0x06, 0x80, 0x0c, 0x80, 0x43, 0x63, 0xeb, 0xd6, 0xad, 0xec, 0x38, 0xcf, 0x22,
+    0x0e, 0x74, 0x7f, 0x95, 0xcd, 0x3f, 0xf3, 0x55, 0xb7, 0xb5, 0x6b, 0xd7, 0xfe, 0xc7, 0xc5, 0xc5,
+    0xe5, 0x9c, 0xbd, 0x1a, 0x00, 0x6b, 0x15, 0x0f, 0x92, 0x01, 0x30, 0xef, 0xd1, 0xc6, 0x6c, 0x03,
+    0xa1, 0xcc, 0x22, 0xf3, 0x57, 0x84, 0xe3, 0xd7, 0x62, 0xc1, 0xe9, 0xd3, 0xa7, 0xd5, 0x7c, 0x34,
+    0x00, 0x8c, 0x02, 0x81, 0xe0, 0x2e, 0xde, 0xe3, 0x76, 0x9a, 0x02, 0x20, 0x03, 0xe0, 0xf0, 0x78,
+    0xf9, 0xe5, 0x97, 0xe5, 0xa8, 0xd3, 0x3b, 0xe6, 0x16, 0x3e, 0x30, 0x30, 0xf0, 0xc7, 0xc3, 0x87,
+    0x0f, 0xf3, 0x56, 0xb7, 0x7e, 0xfd, 0xfa, 0x95, 0x3c, 0xaa, 0x9b, 0x3d, 0x1a, 0x80, 0xa7, 0x14,
+    0x0f, 0xde, 0x34, 0x77, 0xf1, 0x20, 0x19, 0x80, 0x76, 0x1e, 0x32, 0x94, 0xae, 0x87, 0xaf, 0x0e,
+    0x5d, 0x85, 0x23, 0x07, 0xcf, 0xc0, 0xb7, 0x07, 0x73, 0x60, 0xdb, 0xe1, 0x62, 0x88, 0xc1, 0xd7,
+    0x3f, 0xcd, 0x06, 0x48, 0x13, 0x81, 0xe2, 0xe4, 0xd5, 0x8e, 0x65, 0xb3, 0x8f, 0x83, 0x52, 0xa9,
+    0xd4, 0xd8, 0xd3, 0x79, 0x01, 0x6d, 0x61, 0xef, 0xde, 0xbd, 0x41, 0xa7, 0xd3, 0xd5, 0xe2, 0x57,
+    0x3e, 0xa4, 0x03, 0x81, 0x85, 0x8a, 0x00, 0xc9, 0x00, 0xd8, 0x3f, 0x32, 0x32, 0x32, 0x58, 0xa3,
+    0xb8, 0xc1, 0x81, 0x01, 0xf8, 0x60, 0xca, 0x94, 0x29, 0x8d, 0x7c, 0xd5, 0x2d, 0x2d, 0x2d, 0x4d,
+    0xed, 0xe6, 0xe6, 0xf6, 0x03, 0x9f, 0x0c, 0xc0, 0xa3, 0xc5, 0x83, 0xb3, 0x66, 0xcd, 0x32, 0x6b,
+    0xf1, 0x20, 0x19, 0x80, 0xb6, 0xf3, 0xd2, 0xd7, 0xdb, 0xa1, 0xe1, 0xcb, 0xd9, 0x20, 0xdf, 0xf0,
+    0x2e, 0x28, 0x57, 0x87, 0x83, 0x82, 0x71, 0xe3, 0x4c, 0x30, 0x7c, 0x39, 0x0f, 0x4e, 0xef, 0xfe,
+    0x06, 0x76, 0xe6, 0x82, 0x46, 0x28, 0x82, 0x55, 0xe6, 0x6e, 0xbf, 0x62, 0xb1, 0x38, 0xfd, 0xf3,
+    0xcf, 0x3f, 0x07, 0xbe, 0x8e, 0x02, 0xac, 0x5d, 0xbb, 0x56, 0x29, 0x95, 0x4a, 0x8f, 0x76, 0x20,
+    0xb0, 0xd0, 0x32, 0x40, 0x32, 0x00, 0xfc, 0x00, 0x3a, 0x62, 0x56, 0x10, 0xf8, 0x3f, 0x66, 0xd6,
+    0x9e, 0x65, 0x25, 0xa0, 0x56, 0xab, 0x79, 0xab, 0x5b, 0x8f, 0x1e, 0x3d, 0x6a, 0x5a, 0xea, 0xc6,
+    0x27, 0x03, 0xc0, 0x45, 0xf1, 0x20, 0x19, 0x80, 0xd6, 0x33, 0x2e, 0x5d, 0x03, 0x15, 0x5b, 0xe2,
+    0xa0, 0x66, 0xdd, 0xdb, 0x20, 0xf9, 0xb0, 0x37, 0x54, 0x7d, 0xf0, 0xc2, 0x7f, 0xb1, 0xe6, 0xe3,
+    0x20, 0x90, 0x25, 0x45, 0xc1, 0xed, 0x1d, 0xab, 0x20, 0xad, 0x00, 0x54, 0x5c, 0xac, 0x08, 0xb8,
+    0x71, 0xe3, 0x46, 0x03, 0x1f, 0xaa, 0xff, 0x33, 0x33, 0x33, 0x41, 0x2e, 0x97, 0xb3, 0x02, 0x40,
+    0x28, 0x29, 0x29, 0x81, 0x2d, 0x5b, 0xb6, 0xc0, 0xf0, 0xe1, 0xc3, 0xa1, 0x01, 0x81, 0xf7, 0xd9,
+    0xad, 0x9d, 0xfa, 0xd0, 0x46, 0x40, 0x64, 0x00, 0xf8, 0x81, 0xc5, 0x8b, 0x17, 0xd7, 0xa1, 0x56,
+    0xcb, 0xcd, 0x2d, 0x7e, 0xdf, 0xbe, 0x7d, 0x6f, 0x64, 0x65, 0x65, 0xf1, 0x56, 0xb7, 0xf7, 0xde,
+    0x7b, 0xaf, 0xa4, 0xa5, 0x6e, 0x7c, 0x35, 0x00, 0x0f, 0xd1, 0xd1, 0xe2, 0x41, 0x32, 0x00, 0xad,
+    0xe7, 0xdd, 0xad, 0x7f, 0x07, 0xe9, 0x9a, 0xa9, 0xbf, 0x08, 0xfc, 0xbf, 0x30, 0x02, 0x9f, 0xbd,
+    0x05, 0x65, 0x7b, 0x3e, 0xab, 0x13, 0x8a, 0x61, 0x0a, 0x07, 0xd3, 0x00, 0x7a, 0x7b, 0x5e, 0x12,
+    0xb8, 0x62, 0xc5, 0x8a, 0xa6, 0xad, 0xbd, 0xd9, 0xde, 0x06, 0xfd, 0xfb, 0xf7, 0x07, 0x6f, 0x6f,
+    0x6f, 0xb6, 0xbb, 0x27, 0x6c, 0xdb, 0xb6, 0x0d, 0x2a, 0x2a, 0x2a, 0x00, 0x0d, 0x0e, 0x9b, 0xc7,
+    0xff, 0x53, 0x3b, 0x03, 0x0b, 0x6d, 0x05, 0x4c, 0x06, 0x80, 0x3f, 0xd3, 0x00, 0x98, 0xd9, 0xfd,
+    0xaf, 0xb9, 0xc5, 0xc7, 0x46, 0xf8, 0xe5, 0xaa, 0x55, 0xab, 0x78, 0xab, 0x9b, 0x40, 0x20, 0x60,
+    0xf5, 0x13, 0x27, 0x1c, 0xc5, 0x00, 0xb4, 0x44, 0x7b, 0x8a, 0x07, 0xc9, 0x00, 0xb4, 0x72, 0x99,
+    0xdf, 0xbf, 0xc4, 0xa0, 0xf8, 0xfc, 0xfd, 0x67, 0x06, 0xff, 0x87, 0xd4, 0x7d, 0x39, 0x07, 0x0a,
+    0x8e, 0x8b, 0x52, 0xcd, 0xdd, 0x7e, 0xcb, 0xca, 0xca, 0x8a, 0x22, 0x23, 0x23, 0xed, 0x32, 0xf8,
+    0x47, 0x45, 0x45, 0xc1, 0xdd, 0xbb, 0x77, 0x21, 0x38, 0x38, 0xf8, 0x49, 0x9b, 0x03, 0x41, 0x55,
+    0x55, 0x15, 0x1b, 0x01, 0xd8, 0xd0, 0xce, 0xc0, 0x42, 0x87, 0x01, 0x91, 0x01, 0xe0, 0x07, 0xd8,
+    0x26, 0x37, 0xee, 0xee, 0xee, 0x12, 0x0e, 0xf4, 0x8f, 0x66, 0x0d, 0x91, 0xcf, 0xba, 0xb9, 0xb8,
+    0xb8, 0x94, 0x3b, 0xa2, 0x01, 0x68, 0x89, 0x27, 0x14, 0x0f, 0x06, 0x91, 0x01, 0x68, 0x1f, 0xef,
+    0x6c, 0xfb, 0x07, 0xc8, 0x97, 0x85, 0xb4, 0xda, 0x00, 0xd4, 0xac, 0x08, 0x83, 0x8a, 0xe4, 0xa4,
+    0x1a, 0x73, 0x37, 0xde, 0x1f, 0x7f, 0xfc, 0xf1, 0xdb, 0xe5, 0xcb, 0x97, 0xdb, 0xa5, 0x01, 0x10,
+    0x8b, 0xc5, 0xf0, 0x2c, 0xf3, 0x62, 0x3a, 0xc5, 0xb4, 0xb8, 0x03, 0x06, 0x80, 0x8e, 0x03, 0x26,
+    0x03, 0x60, 0xff, 0xd0, 0xe9, 0x74, 0x2c, 0x90, 0xd5, 0x73, 0xa0, 0xff, 0x84, 0x3f, 0xfe, 0xf1,
+    0x8f, 0xbc, 0xd6, 0x0d, 0x83, 0x7e, 0x9d, 0xa3, 0x1b, 0x80, 0x96, 0x78, 0xa4, 0x78, 0xb0, 0x10,
+    0x65, 0xf9, 0x82, 0x0c, 0x40, 0xdb, 0xc8, 0x0a, 0xfc, 0x24, 0x31, 0x7e, 0xad, 0x37, 0x00, 0x8b,
+    0x7f, 0x0d, 0xea, 0x6d, 0x1f, 0x9b, 0x7d, 0x6d, 0x78, 0x7e, 0x7e, 0xfe, 0xce, 0xcd, 0x9b, 0x37,
+    0xdb, 0x5d, 0xf0, 0x1f, 0x38, 0x70, 0x20, 0x48, 0xa5, 0xd2, 0x67, 0xfe, 0xdc, 0xdb, 0x6f, 0xbf,
+    0x0d, 0x32, 0x99, 0x4c, 0xd3, 0x01, 0x03, 0xc0, 0x98, 0x64, 0xc1, 0xe6, 0x95, 0xf4, 0xf0, 0xef,
+    0x12, 0xc8, 0x00, 0x98, 0x15, 0x9d, 0x9a, 0x37, 0xb7, 0x31, 0x37, 0x5e, 0x45, 0x38, 0x8c, 0x6e,
+    0x64, 0x00, 0xfe, 0x7f, 0x6a, 0x04, 0xa6, 0x4c, 0x99, 0xa2, 0x74, 0x72, 0x72, 0x6a, 0x7c, 0xfe,
+    0xf9, 0xe7, 0x0b, 0xc9, 0x00, 0xb4, 0xe1, 0x14, 0x40, 0x61, 0x43, 0x53, 0xd5, 0x7f, 0x6b, 0x83,
+    0x3f, 0x23, 0x2b, 0x12, 0x34, 0x6c, 0x59, 0xd0, 0x68, 0xee, 0xc6, 0x7b, 0xf1, 0xe2, 0xc5, 0xcd,
+    0x6c, 0x43, 0x2f, 0x7b, 0x33, 0x00, 0xa3, 0x46, 0x8d, 0x82, 0xe2, 0xe2, 0xe2, 0x56, 0xfd, 0x9c,
+    0x42, 0xa1, 0xa8, 0xef, 0xa0, 0x01, 0xb0, 0xd4, 0x92, 0x40, 0x71, 0xcb, 0xbf, 0x49, 0x20, 0x03,
+    0x40, 0x23, 0x00, 0x34, 0x02, 0x60, 0x33, 0xc8, 0xc9, 0xc9, 0x81, 0xf7, 0xdf, 0x7f, 0x5f, 0x83,
+    0x01, 0x5f, 0xeb, 0xeb, 0xeb, 0xcb, 0x8e, 0x9e, 0x7e, 0x1f, 0xe9, 0x49, 0x53, 0x00, 0x96, 0x1a,
+    0x01, 0xf8, 0x88, 0x46, 0x00, 0xac, 0x33, 0x02, 0xf0, 0x70, 0x2a, 0x80, 0xcb, 0x8d, 0x81, 0xa4,
+    0x0f, 0x87, 0xfe, 0xc9, 0x00, 0x90, 0x01, 0xa0, 0x1a, 0x00, 0xaa, 0x01, 0xb0, 0x09, 0x5c, 0xb9,
+    0x72, 0x05, 0xe2, 0xe3, 0xe3, 0x8d, 0x7e, 0x7e, 0x7e, 0x6c, 0xee, 0x9f, 0xed, 0x25, 0xf1, 0x37,
+    0x64, 0x20, 0x15, 0x01, 0x76, 0x8c, 0xb7, 0xb7, 0xad, 0x04, 0x65, 0xfc, 0xb0, 0x56, 0x1b, 0x00,
+    0xc5, 0xa7, 0xaf, 0x42, 0xf9, 0xbe, 0x4d, 0x54, 0x03, 0x60, 0xf9, 0x1a, 0x80, 0x96, 0x1c, 0xc9,
+    0x91, 0x09, 0x90, 0x9a, 0xde, 0xbb, 0x13, 0x19, 0x00, 0x32, 0x00, 0x9c, 0x80, 0x56, 0x01, 0xb4,
+    0x7b, 0xa8, 0xdb, 0xe1, 0x56, 0x01, 0xdc, 0xbb, 0x77, 0x0f, 0x92, 0x92, 0x92, 0x60, 0xf0, 0xe0,
+    0xc1, 0xac, 0xfa, 0xff, 0x7e, 0x97, 0x2e, 0x5d, 0x3e, 0xc3, 0x5b, 0xff, 0x1d, 0x2d, 0x03, 0x34,
+    0x1f, 0xf7, 0xa7, 0x5c, 0x02, 0xc5, 0xe7, 0xb3, 0x68, 0x15, 0x80, 0xed, 0xaf, 0x02, 0x78, 0xdc,
+    0x48, 0x80, 0x39, 0xa7, 0x03, 0xc4, 0x8f, 0x66, 0xfe, 0x64, 0x00, 0xc8, 0x00, 0x98, 0x1d, 0xb4,
+    0x0f, 0x40, 0xfb, 0xe0, 0x28, 0xfb, 0x00, 0x28, 0x95, 0x4a, 0xd8, 0xbd, 0x7b, 0x37, 0x8c, 0x18,
+    0x31, 0x82, 0xad, 0xff, 0x57, 0x79, 0x79, 0x79, 0xed, 0xc3, 0xdb, 0x1d, 0xdb, 0xd6, 0xef, 0x03,
+    0x19, 0x80, 0xb6, 0xac, 0x04, 0xf8, 0x14, 0xe4, 0xab, 0x26, 0x3e, 0x33, 0xf8, 0xcb, 0xd6, 0x45,
+    0x40, 0x69, 0x72, 0x12, 0xed, 0x03, 0x60, 0xf9, 0x7d, 0x00, 0x9e, 0x46, 0x73, 0x14, 0x06, 0x26,
+    0x3d, 0xed, 0x6f, 0x10, 0xc8, 0x00, 0x98, 0x0d, 0xb4, 0x13, 0x60, 0xfb, 0xc0, 0xf7, 0x9d, 0x00,
+    0x1f, 0x16, 0xf3, 0x39, 0x3b, 0x3b, 0x37, 0xf8, 0xf8, 0xf8, 0x64, 0xe1, 0x2d, 0xfe, 0xa9, 0x23,
+    0x5f, 0x08, 0x32, 0x00, 0x6d, 0xdb, 0x09, 0xb0, 0x72, 0x4b, 0x2c, 0x48, 0xd7, 0xbf, 0xf3, 0xc4,
+    0x9d, 0x00, 0x6b, 0x36, 0xbc, 0x0b, 0x77, 0xb6, 0xaf, 0xa0, 0x9d, 0x00, 0xad, 0xb3, 0x13, 0xe0,
+    0xb3, 0xc8, 0x32, 0x77, 0xb6, 0x66, 0xbf, 0x2d, 0x7d, 0x82, 0xd1, 0xf4, 0x3b, 0x43, 0x9f, 0xf5,
+    0xfe, 0x04, 0x32, 0x00, 0x66, 0x1b, 0xfe, 0xa7, 0xb3, 0x00, 0xda, 0x0e, 0xbe, 0x9e, 0x05, 0xd0,
+    0x9a, 0x62, 0x3e, 0x32, 0x00, 0x96, 0xe3, 0xc5, 0xaf, 0xbf, 0x6e, 0x5a, 0x15, 0xa0, 0xd8, 0x10,
+    0x05, 0x9a, 0x15, 0xaf, 0x81, 0x7a, 0xe5, 0x78, 0x50, 0x6e, 0x7c, 0xb7, 0xa9, 0x50, 0xf0, 0xe4,
+    0x9e, 0x7f, 0xd2, 0x59, 0x00, 0xd6, 0x3b, 0x0b, 0xa0, 0xb5, 0x64, 0x3b, 0x06, 0x46, 0x9a, 0x02,
+    0xbb, 0xd8, 0x34, 0xa7, 0x6f, 0x34, 0x51, 0x6a, 0x7a, 0x6d, 0x97, 0xe9, 0x67, 0xdc, 0x5b, 0xfb,
+    0xbe, 0x04, 0x32, 0x00, 0x66, 0x01, 0x9d, 0x06, 0xd8, 0x3e, 0xf0, 0xe9, 0x34, 0xc0, 0xb6, 0x16,
+    0xf3, 0x91, 0x01, 0xa0, 0xd3, 0x00, 0x1d, 0xfd, 0x34, 0x40, 0x02, 0x19, 0x00, 0xbb, 0xc7, 0xd6,
+    0xad, 0x5b, 0xc1, 0xc7, 0xc7, 0xa7, 0x88, 0x03, 0xdd, 0x5f, 0x65, 0xbb, 0xc2, 0xf1, 0x55, 0x37,
+    0xcc, 0x1e, 0xfe, 0xe3, 0xe2, 0xe2, 0x72, 0xee, 0xd1, 0x9b, 0xb6, 0x27, 0x03, 0xd0, 0x91, 0x62,
+    0x3e, 0x32, 0x00, 0xd6, 0xe7, 0x47, 0x99, 0x00, 0x87, 0xf3, 0x41, 0x99, 0x59, 0x64, 0xfe, 0x83,
+    0x61, 0xf0, 0xeb, 0xb1, 0xe0, 0xf4, 0xe9, 0xd3, 0x6a, 0xbe, 0x66, 0xff, 0x02, 0x81, 0xe0, 0x2e,
+    0xde, 0xe3, 0x76, 0x0a, 0x8f, 0x64, 0x00, 0x1c, 0x16, 0x22, 0x91, 0xe8, 0xe1, 0x26, 0x36, 0xbf,
+    0x37, 0xb7, 0xe8, 0xe8, 0xb0, 0x8b, 0xd8, 0x06, 0x22, 0x8e, 0xa6, 0x9b, 0xad, 0x1b, 0x00, 0x73,
+    0x15, 0xf3, 0x91, 0x01, 0xb0, 0x3e, 0xf7, 0xe5, 0x81, 0x22, 0x55, 0x04, 0x5f, 0x72, 0xf1, 0x39,
+    0x29, 0x14, 0x0a, 0xf9, 0x1b, 0x6f, 0xbc, 0xc1, 0xcb, 0xe0, 0x3f, 0x67, 0xce, 0x1c, 0x23, 0x66,
+    0xff, 0x65, 0xd8, 0x1c, 0xdc, 0x28, 0x3c, 0x92, 0x01, 0x70, 0x48, 0xb0, 0x83, 0x5c, 0x7a, 0xf6,
+    0xec, 0xc9, 0x0a, 0xff, 0x66, 0x9a, 0x5b, 0x70, 0x0c, 0x2a, 0xef, 0x05, 0x07, 0x07, 0xab, 0xf9,
+    0xaa, 0x9b, 0x9f, 0x9f, 0x9f, 0xea, 0x49, 0xba, 0xd9, 0xaa, 0x01, 0x60, 0xc5, 0x7c, 0x53, 0xa7,
+    0x4e, 0x55, 0x98, 0xab, 0x98, 0x8f, 0x0c, 0x80, 0x95, 0x0f, 0x0b, 0xc2, 0xe0, 0x2f, 0xc8, 0x87,
+    0x23, 0x5c, 0x7c, 0x46, 0xc5, 0xc5, 0xc5, 0x7b, 0x0f, 0x1f, 0x3e, 0xdc, 0xc8, 0xc7, 0xe0, 0x3f,
+    0x79, 0xf2, 0x64, 0x56, 0x08, 0xc8, 0xea, 0x92, 0x46, 0x53, 0x68, 0x24, 0x03, 0xe0, 0x90, 0x60,
+    0x9b, 0xd7, 0x04, 0x05, 0x05, 0x29, 0x50, 0x9b, 0x38, 0x0e, 0xf4, 0xee, 0xee, 0xe9, 0xe9, 0xa9,
+    0x3a, 0x75, 0xea, 0x14, 0x2f, 0x75, 0xf3, 0xf7, 0xf7, 0x97, 0x3e, 0x4d, 0x37, 0x5b, 0x32, 0x00,
+    0x2d, 0x8b, 0xf9, 0x30, 0xe8, 0x9b, 0xb5, 0x98, 0x8f, 0x0c, 0x80, 0x75, 0x18, 0x9b, 0x05, 0x90,
+    0x92, 0x07, 0x72, 0xcc, 0xfc, 0xf7, 0x71, 0xd4, 0x59, 0xfe, 0x01, 0xb3, 0xe3, 0x7a, 0x7b, 0x5e,
+    0xfa, 0xf7, 0xb4, 0xd5, 0x00, 0x75, 0x75, 0x75, 0x7a, 0xbc, 0xc7, 0xe9, 0x14, 0x16, 0xc9, 0x00,
+    0x38, 0x24, 0xd8, 0x41, 0x2d, 0xd8, 0x18, 0xd4, 0xa8, 0xcb, 0x5f, 0xb9, 0x10, 0x1b, 0x8d, 0x45,
+    0x4e, 0x6c, 0x6c, 0x2c, 0x2f, 0x75, 0x43, 0x63, 0xa3, 0x7c, 0x96, 0x6e, 0xd6, 0x36, 0x00, 0x4f,
+    0x28, 0xe6, 0x0b, 0xb2, 0x95, 0xc6, 0x48, 0x06, 0xa0, 0xfd, 0x5c, 0xf3, 0x1d, 0x40, 0xba, 0x08,
+    0x74, 0x19, 0x22, 0x88, 0xe7, 0xea, 0xf3, 0xa9, 0xac, 0xac, 0x2c, 0x67, 0x6b, 0xe6, 0xf9, 0x16,
+    0xfc, 0x17, 0x2c, 0x58, 0x50, 0x67, 0xca, 0xfc, 0xff, 0x42, 0x21, 0x91, 0x0c, 0x80, 0x43, 0x82,
+    0x9d, 0xdd, 0xee, 0xea, 0xea, 0xaa, 0x47, 0x4d, 0x66, 0x70, 0x21, 0xb4, 0xb3, 0xb3, 0x73, 0xdc,
+    0xf0, 0xe1, 0xc3, 0x15, 0x8e, 0xac, 0x9b, 0x35, 0x0c, 0x80, 0x35, 0x8a, 0xf9, 0xc8, 0x00, 0x58,
+    0x8e, 0x7f, 0xc3, 0xac, 0x7f, 0xf7, 0x05, 0xa8, 0x15, 0x88, 0xa0, 0x54, 0x28, 0x86, 0xd7, 0xb9,
+    0xfa, 0x6c, 0x2a, 0x2a, 0x2a, 0x52, 0x53, 0x52, 0x52, 0xea, 0xf8, 0x16, 0xfc, 0x93, 0x93, 0x93,
+    0x6b, 0xd5, 0x6a, 0x35, 0x9b, 0xf3, 0x1f, 0x41, 0xe1, 0x90, 0x0c, 0x80, 0xc3, 0xa1, 0xa8, 0xa8,
+    0x08, 0x5e, 0x79, 0xe5, 0x15, 0xb9, 0x69, 0x18, 0x78, 0x20, 0x47, 0x3a, 0x47, 0x78, 0x78, 0x78,
+    0xa8, 0xd8, 0x30, 0x39, 0x9f, 0x74, 0x0b, 0x0d, 0x0d, 0x55, 0x06, 0x06, 0x06, 0x5e, 0x6d, 0xad,
+    0x6e, 0x96, 0x32, 0x00, 0xd6, 0x2e, 0xe6, 0x23, 0x03, 0x60, 0x81, 0x53, 0x01, 0x33, 0x01, 0xbe,
+    0xc8, 0x01, 0xc0, 0xa0, 0xdf, 0x20, 0x14, 0x41, 0x22, 0xc7, 0x9d, 0x64, 0xfc, 0xf5, 0xeb, 0xd7,
+    0xa5, 0x7c, 0x0a, 0xfc, 0x33, 0x66, 0xcc, 0x60, 0xe6, 0xb8, 0x16, 0x8d, 0x8d, 0x10, 0xef, 0xcf,
+    0x9d, 0x42, 0x21, 0x19, 0x00, 0x87, 0x02, 0xdb, 0x02, 0x73, 0xde, 0xbc, 0x79, 0x3a, 0xcc, 0x08,
+    0xd9, 0x69, 0x57, 0x8b, 0x38, 0xd4, 0x98, 0x05, 0x9e, 0xa6, 0x39, 0x67, 0xbe, 0xe8, 0x16, 0x1d,
+    0x1d, 0x5d, 0xd5, 0x1e, 0xdd, 0xb8, 0x36, 0x00, 0xb6, 0x52, 0xcc, 0x47, 0x06, 0x80, 0x3b, 0x2e,
+    0x3e, 0x06, 0xb0, 0xe9, 0x6c, 0xd3, 0x70, 0xbf, 0x3e, 0x4d, 0x04, 0x87, 0xd0, 0x00, 0x0c, 0xe0,
+    0xb8, 0x83, 0x9c, 0x55, 0x55, 0x55, 0xa5, 0x1e, 0x36, 0x6c, 0x18, 0x2f, 0x02, 0xff, 0xe8, 0xd1,
+    0xa3, 0xe1, 0xfc, 0xf9, 0xf3, 0x15, 0x2a, 0x95, 0xaa, 0x1c, 0xef, 0x2d, 0x82, 0x42, 0x20, 0x19,
+    0x00, 0x87, 0x2b, 0xf2, 0x5b, 0xb8, 0x70, 0x21, 0x1b, 0xb2, 0x06, 0xcc, 0x0e, 0xbf, 0xc0, 0x47,
+    0x6f, 0x0e, 0xf5, 0x0d, 0xc5, 0x40, 0x69, 0x30, 0x9d, 0xaa, 0x65, 0xf7, 0xba, 0xcd, 0x9c, 0x39,
+    0xb3, 0xaa, 0x53, 0xf3, 0x12, 0xbf, 0xa4, 0xf6, 0xe8, 0xc6, 0x85, 0x01, 0x60, 0xc6, 0x6a, 0xd6,
+    0xac, 0x59, 0x36, 0x55, 0xcc, 0x47, 0x06, 0xc0, 0xfc, 0x5c, 0x7e, 0x02, 0xe0, 0xeb, 0x5c, 0x50,
+    0xa1, 0x46, 0x8d, 0x69, 0x85, 0xb0, 0xf7, 0x98, 0x18, 0x86, 0x5a, 0xa0, 0x73, 0x8c, 0xc4, 0x40,
+    0xa9, 0x1f, 0x3b, 0x76, 0xac, 0xdd, 0x07, 0xfe, 0xf1, 0xe3, 0xc7, 0xc3, 0x99, 0x33, 0x67, 0xca,
+    0x0d, 0x06, 0x03, 0x9b, 0x86, 0x8c, 0xa5, 0xd0, 0x47, 0x70, 0x28, 0x03, 0x70, 0xfc, 0xf8, 0x71,
+    0x08, 0x0f, 0x0f, 0x57, 0x62, 0x40, 0x66, 0x59, 0x3f, 0x3b, 0xe1, 0x2a, 0x80, 0x63, 0x6d, 0x47,
+    0xe3, 0xdf, 0xd1, 0x1f, 0x3c, 0x78, 0xd0, 0xee, 0x75, 0x9b, 0x30, 0x61, 0x42, 0x4d, 0xe7, 0xce,
+    0x9d, 0xb5, 0x78, 0x4f, 0xeb, 0x3a, 0xa2, 0x9b, 0xb9, 0x0c, 0xc0, 0x23, 0xc5, 0x7c, 0x37, 0x3b,
+    0xd9, 0x58, 0x31, 0x1f, 0x19, 0x00, 0xf3, 0x30, 0xfe, 0x38, 0x66, 0xfb, 0x39, 0xcd, 0x1b, 0xfa,
+    0x08, 0x0a, 0xe0, 0x5e, 0xa6, 0x18, 0x96, 0xa4, 0xe6, 0x81, 0xaf, 0x85, 0x3a, 0xc6, 0x28, 0xb5,
+    0x5a, 0x6d, 0x98, 0x38, 0x71, 0xa2, 0xbd, 0xaf, 0xeb, 0x67, 0xed, 0x45, 0xa2, 0xd1, 0x68, 0xee,
+    0xe3, 0x3d, 0x2d, 0x41, 0x3e, 0x47, 0x61, 0x8f, 0xe0, 0x10, 0x06, 0xa0, 0xb0, 0xb0, 0x10, 0x62,
+    0x63, 0x63, 0xeb, 0x7d, 0x7d, 0x7d, 0x55, 0x18, 0x28, 0xae, 0xe3, 0xfd, 0xce, 0x47, 0x5a, 0xa2,
+    0x01, 0x4c, 0xc6, 0x60, 0xd7, 0x70, 0xe8, 0xd0, 0x21, 0xbb, 0xd5, 0x6d, 0xee, 0xdc, 0xb9, 0x65,
+    0xdd, 0xbb, 0x77, 0x97, 0x79, 0x7a, 0x7a, 0xfe, 0x60, 0x2e, 0xdd, 0x3a, 0x62, 0x00, 0xec, 0xa9,
+    0x98, 0x8f, 0x0c, 0x40, 0xfb, 0xf9, 0x49, 0x76, 0xd3, 0xdc, 0x7e, 0xc3, 0xa1, 0x7c, 0x50, 0xa4,
+    0x89, 0x40, 0x9a, 0x2e, 0x86, 0x1d, 0xc7, 0x8a, 0x60, 0x94, 0x85, 0x3b, 0xc5, 0x85, 0x32, 0x99,
+    0x4c, 0x1b, 0x16, 0x16, 0x66, 0xb7, 0x4b, 0xfa, 0x84, 0x42, 0x61, 0x29, 0x66, 0xfb, 0x1a, 0x95,
+    0x4a, 0x75, 0x0e, 0xef, 0xe7, 0x2d, 0x0a, 0x75, 0x04, 0x87, 0x30, 0x00, 0x27, 0x4f, 0x9e, 0x84,
+    0x45, 0x8b, 0x16, 0xe9, 0x31, 0x3b, 0xac, 0xf5, 0xf2, 0xf2, 0xaa, 0xc0, 0xcc, 0x95, 0x05, 0x0a,
+    0x4b, 0xee, 0x69, 0x3d, 0x8b, 0x0d, 0xfb, 0xb3, 0xcc, 0xd9, 0xde, 0x74, 0x8b, 0x8a, 0x8a, 0x2a,
+    0xc5, 0x0e, 0x44, 0xd2, 0xb5, 0x6b, 0xd7, 0xbb, 0x78, 0x1f, 0x89, 0xe6, 0xd6, 0xad, 0xad, 0x06,
+    0xc0, 0x5e, 0x8b, 0xf9, 0xc8, 0x00, 0xb4, 0x2d, 0xcb, 0x5f, 0x7f, 0x1a, 0x20, 0xf9, 0x02, 0x28,
+    0xd9, 0x32, 0x3e, 0x81, 0x08, 0x6e, 0xa7, 0x17, 0xc0, 0x7a, 0xa1, 0xc8, 0x3a, 0x9b, 0xd1, 0xe0,
+    0xd7, 0x6e, 0x55, 0x59, 0x59, 0x99, 0xc2, 0x9e, 0xf6, 0xf9, 0x0f, 0x08, 0x08, 0x60, 0x75, 0x39,
+    0x90, 0x95, 0x95, 0x55, 0xae, 0xd5, 0x6a, 0x6b, 0x91, 0xdf, 0xe3, 0x7d, 0xc4, 0x21, 0xfb, 0x51,
+    0x88, 0x23, 0xf0, 0xd6, 0x00, 0x18, 0x8d, 0x46, 0xc8, 0xcd, 0xcd, 0x85, 0x35, 0x6b, 0xd6, 0xb0,
+    0x20, 0x21, 0x67, 0x59, 0xb7, 0x8f, 0x8f, 0x0f, 0xab, 0x4a, 0x4f, 0xb0, 0x70, 0xd0, 0x6f, 0x82,
+    0x9b, 0x9b, 0x5b, 0x52, 0xaf, 0x5e, 0xbd, 0x64, 0x2c, 0x83, 0xb6, 0x07, 0xdd, 0x12, 0x12, 0x12,
+    0x24, 0x21, 0x21, 0x21, 0x95, 0xce, 0xce, 0xce, 0x46, 0xbc, 0x76, 0x11, 0xd7, 0xba, 0xb5, 0xd6,
+    0x00, 0xd8, 0x7b, 0x31, 0x1f, 0x19, 0x80, 0x27, 0x1c, 0xda, 0x73, 0x0c, 0xe0, 0x1f, 0x27, 0x9b,
+    0x87, 0xf5, 0xd9, 0x56, 0xbd, 0x2c, 0xe0, 0x63, 0x96, 0x5f, 0x91, 0x2a, 0x82, 0x7f, 0x65, 0x8a,
+    0x21, 0x2a, 0xa3, 0x10, 0xfa, 0x58, 0x53, 0xff, 0xfb, 0xf7, 0xef, 0x1f, 0xc3, 0xb6, 0x2b, 0xed,
+    0xdf, 0xbf, 0xbf, 0x4d, 0x07, 0xfc, 0x3e, 0x7d, 0xfa, 0x40, 0x44, 0x44, 0x04, 0xec, 0xdc, 0xb9,
+    0x53, 0x72, 0xf3, 0xe6, 0xcd, 0x6a, 0x6c, 0xcf, 0xf5, 0x98, 0xe9, 0x9f, 0xc5, 0xa6, 0x13, 0x83,
+    0xec, 0x4f, 0x61, 0x8d, 0xc0, 0x3b, 0x03, 0xc0, 0x8e, 0xa6, 0xbe, 0x7c, 0xf9, 0x32, 0xec, 0xd9,
+    0xb3, 0x87, 0xcd, 0x6b, 0x69, 0x07, 0x0d, 0x1a, 0xc4, 0x76, 0xeb, 0x03, 0x6f, 0x6f, 0xef, 0x1f,
+    0xbb, 0x75, 0xeb, 0xb6, 0x19, 0x9f, 0xbf, 0x89, 0xec, 0x6e, 0x25, 0x1d, 0x3d, 0x30, 0xf0, 0x9f,
+    0x1f, 0x33, 0x66, 0x8c, 0x4c, 0x22, 0x91, 0xd8, 0xac, 0x6e, 0x91, 0x91, 0x91, 0x95, 0x41, 0x41,
+    0x41, 0x95, 0x4c, 0x37, 0xd4, 0xec, 0x0a, 0x3e, 0x6e, 0xb0, 0xa4, 0x6e, 0x4f, 0x33, 0x00, 0x7c,
+    0x2a, 0xe6, 0x73, 0x74, 0x03, 0xc0, 0x96, 0xe8, 0x25, 0x9c, 0x00, 0x48, 0x3c, 0x05, 0xb0, 0xf9,
+    0x2c, 0xd4, 0xef, 0xbf, 0x00, 0x0a, 0x41, 0x01, 0xa8, 0xd3, 0xc5, 0xa0, 0xc6, 0x47, 0x11, 0x06,
+    0xfe, 0x24, 0xbc, 0xd7, 0x3f, 0x1f, 0xbf, 0x0a, 0xfe, 0x36, 0xd2, 0x09, 0x0e, 0xa9, 0xaa, 0xaa,
+    0xba, 0xb3, 0x7f, 0xff, 0x7e, 0xbd, 0xad, 0x05, 0x7b, 0x7f, 0x7f, 0x7f, 0x56, 0x83, 0xc3, 0x6a,
+    0x5e, 0x0c, 0x98, 0xe1, 0x57, 0x3e, 0x78, 0xf0, 0xa0, 0x0a, 0x03, 0xbe, 0x5e, 0xa3, 0xd1, 0xe4,
+    0xe1, 0x75, 0xaf, 0x40, 0xbe, 0x8e, 0xec, 0x4c, 0xa1, 0x8c, 0xc0, 0x0b, 0x03, 0x20, 0x95, 0x4a,
+    0x21, 0x3f, 0x3f, 0x1f, 0x0e, 0x1c, 0x38, 0xc0, 0x32, 0xd4, 0xc6, 0x49, 0x93, 0x26, 0x29, 0xd1,
+    0xf1, 0x2a, 0x9d, 0x9c, 0x9c, 0x1a, 0xbb, 0x77, 0xef, 0x5e, 0x82, 0x01, 0x3f, 0x15, 0xaf, 0xfb,
+    0x23, 0x24, 0x1b, 0x22, 0xb4, 0x85, 0x82, 0x96, 0x71, 0x5e, 0x5e, 0x5e, 0x92, 0xb8, 0xb8, 0x38,
+    0x9b, 0xd1, 0x6d, 0xd9, 0xb2, 0x65, 0xf5, 0xe1, 0xe1, 0xe1, 0xb5, 0x81, 0x81, 0x81, 0xb5, 0x4c,
+    0x37, 0x77, 0x77, 0xf7, 0x5b, 0xae, 0xae, 0xae, 0x07, 0xad, 0xad, 0xdb, 0xa3, 0x06, 0x80, 0x15,
+    0xf3, 0x2d, 0x5d, 0xba, 0x94, 0x77, 0xc5, 0x7c, 0x8e, 0x60, 0x00, 0xd8, 0x06, 0x3c, 0x09, 0xd9,
+    0x00, 0xab, 0xbf, 0x03, 0xd8, 0x88, 0x19, 0xfd, 0xce, 0x5c, 0xd0, 0x1c, 0xc8, 0x03, 0x39, 0x0b,
+    0xf4, 0x42, 0x31, 0xd4, 0x1d, 0x2d, 0x80, 0xbb, 0xa9, 0x05, 0x90, 0x29, 0x2c, 0x84, 0x4f, 0xd2,
+    0x0b, 0x60, 0x9a, 0xf0, 0x12, 0xfc, 0xc6, 0x16, 0x35, 0xd7, 0xe9, 0x74, 0xef, 0xd6, 0x23, 0x58,
+    0xfb, 0xb5, 0x66, 0xa0, 0xc7, 0x84, 0x86, 0x15, 0x29, 0x43, 0x4c, 0x4c, 0x0c, 0x6c, 0xdf, 0xbe,
+    0x5d, 0x9f, 0x9b, 0x9b, 0xab, 0x44, 0x53, 0xa2, 0xc2, 0x4b, 0x33, 0x60, 0x76, 0x7f, 0x0d, 0x9b,
+    0xcb, 0x4e, 0xe4, 0x5c, 0xe4, 0x70, 0x0a, 0x5b, 0x04, 0xbb, 0x34, 0x00, 0x2c, 0x3b, 0xbe, 0x76,
+    0xed, 0x1a, 0xb0, 0xbd, 0xf0, 0xd1, 0x6d, 0x43, 0x62, 0x62, 0x22, 0xcc, 0x9e, 0x3d, 0x5b, 0x3b,
+    0x6e, 0xdc, 0x38, 0x45, 0xdf, 0xbe, 0x7d, 0x15, 0x5d, 0xbb, 0x76, 0x35, 0x20, 0xd9, 0x31, 0x9b,
+    0x37, 0x30, 0x20, 0x64, 0xe0, 0xf5, 0x7d, 0x8a, 0x64, 0x05, 0x2c, 0xac, 0xd8, 0xcb, 0xd5, 0xd6,
+    0xc4, 0xc3, 0x6b, 0x5c, 0x83, 0x19, 0xab, 0x81, 0xeb, 0x62, 0xbf, 0x47, 0x75, 0x5b, 0xbd, 0x7a,
+    0x75, 0x7d, 0x74, 0x74, 0xb4, 0x6c, 0xe4, 0xc8, 0x91, 0x55, 0x01, 0x01, 0x01, 0x52, 0xb6, 0xda,
+    0x00, 0xa9, 0xf2, 0xf0, 0xf0, 0xf8, 0x37, 0x5e, 0x8f, 0xc0, 0x56, 0x75, 0x63, 0x06, 0xa0, 0x65,
+    0x31, 0x1f, 0x5e, 0xef, 0xc3, 0x62, 0xbe, 0xdf, 0x53, 0x53, 0xb4, 0xbe, 0x01, 0x60, 0x47, 0xe8,
+    0xb2, 0xfd, 0xf4, 0x59, 0xf6, 0xbe, 0xe2, 0x24, 0xc0, 0xda, 0x53, 0xcd, 0xc1, 0x7d, 0xdb, 0x39,
+    0xd0, 0xef, 0xb9, 0x08, 0xca, 0x94, 0x4b, 0x20, 0xc7, 0xc0, 0x5e, 0x8b, 0x01, 0xde, 0x88, 0x59,
+    0xbc, 0x12, 0x03, 0xfc, 0x4d, 0x81, 0x08, 0xb2, 0xd3, 0x44, 0xb0, 0x49, 0x28, 0x82, 0xf9, 0x99,
+    0x85, 0x10, 0x76, 0x4c, 0x0c, 0xbf, 0xb6, 0x93, 0x8e, 0xcf, 0xa9, 0xb4, 0xb4, 0xf4, 0xe8, 0xed,
+    0xdb, 0xb7, 0xb5, 0x2c, 0xf0, 0x72, 0x15, 0xd8, 0x7d, 0x7c, 0x7c, 0x60, 0xe0, 0xc0, 0x81, 0x30,
+    0x66, 0xcc, 0x18, 0x98, 0x3e, 0x7d, 0x7a, 0x53, 0x80, 0xc7, 0xef, 0xbf, 0x4e, 0x20, 0x10, 0x48,
+    0x8b, 0x8a, 0x8a, 0x30, 0xc6, 0x57, 0xd5, 0x30, 0x03, 0xa2, 0xd7, 0xeb, 0x65, 0x18, 0xe8, 0x2f,
+    0x6b, 0xb5, 0x5a, 0xb6, 0x6c, 0x28, 0x1e, 0x39, 0x0d, 0x39, 0x90, 0x5a, 0x05, 0xc1, 0x62, 0x06,
+    0x80, 0x0d, 0x17, 0xd7, 0xd5, 0xd5, 0x01, 0xba, 0x62, 0xc0, 0x2f, 0x23, 0xc8, 0x64, 0x32, 0xc0,
+    0x2f, 0x28, 0x94, 0x97, 0x97, 0x03, 0x36, 0x14, 0x28, 0x2e, 0x2e, 0x6e, 0xaa, 0x10, 0xbf, 0x70,
+    0xe1, 0x42, 0x53, 0xd1, 0x58, 0x5a, 0x5a, 0x5a, 0x53, 0xc6, 0xb9, 0x63, 0xc7, 0x0e, 0x58, 0xbf,
+    0x7e, 0x3d, 0xcb, 0xd8, 0x1b, 0xd8, 0xe6, 0x3a, 0x11, 0x11, 0x11, 0x2a, 0x16, 0xd4, 0x83, 0x83,
+    0x83, 0xe5, 0xfe, 0xfe, 0xfe, 0x4a, 0x36, 0xac, 0xdb, 0xa9, 0x79, 0xdd, 0x3d, 0x2b, 0xcc, 0x2b,
+    0xc5, 0x46, 0x21, 0xc6, 0xc6, 0x91, 0x6a, 0x5a, 0x8e, 0xb7, 0xd0, 0x34, 0x0c, 0xfd, 0x72, 0x27,
+    0x6e, 0xd7, 0xe4, 0x9b, 0x13, 0x83, 0x7c, 0x7d, 0x7d, 0x8b, 0xc2, 0xc2, 0xc2, 0xb4, 0x25, 0x25,
+    0x25, 0x1d, 0xd6, 0x2d, 0x3e, 0x3e, 0x5e, 0x8f, 0x46, 0x48, 0x39, 0x6d, 0xda, 0xb4, 0x9a, 0x51,
+    0xa3, 0x46, 0x55, 0x63, 0x70, 0x94, 0xf4, 0xea, 0xd5, 0x4b, 0xee, 0xe6, 0xe6, 0xc6, 0x36, 0xdb,
+    0x01, 0x34, 0x45, 0x4a, 0x4f, 0x4f, 0xcf, 0x7b, 0x68, 0x38, 0x44, 0x98, 0xcd, 0xb3, 0x53, 0xce,
+    0xd6, 0xd9, 0xa3, 0x6e, 0x78, 0xed, 0x6a, 0x47, 0x28, 0xe6, 0x33, 0x97, 0x01, 0x88, 0x31, 0x91,
+    0x0d, 0xa9, 0x7f, 0x64, 0xe2, 0xc7, 0xc7, 0x9a, 0x37, 0xc3, 0x61, 0x19, 0xf8, 0x12, 0x7c, 0x8c,
+    0xc3, 0xc7, 0xa5, 0xc7, 0x9b, 0x83, 0xf6, 0xdf, 0x31, 0x23, 0xff, 0x14, 0x03, 0xf7, 0xca, 0xef,
+    0x9a, 0x33, 0xf3, 0xc4, 0xd3, 0xcd, 0x05, 0x76, 0x1b, 0xcf, 0x34, 0xcf, 0xbb, 0x6f, 0x3d, 0x07,
+    0x86, 0xaf, 0xce, 0x83, 0x3a, 0x19, 0x83, 0xf9, 0x37, 0x98, 0xad, 0xff, 0x33, 0x1f, 0xe4, 0xdf,
+    0xe6, 0x37, 0x05, 0x72, 0x6d, 0xba, 0x18, 0x1a, 0xd8, 0xe6, 0x3a, 0xa9, 0x62, 0xa8, 0xc6, 0x2c,
+    0xfe, 0x27, 0x64, 0xde, 0xd1, 0x7c, 0x38, 0x8a, 0xc1, 0x7e, 0x23, 0x5e, 0xd7, 0xc7, 0xc8, 0xb7,
+    0xd3, 0xc4, 0xf0, 0x6a, 0xe6, 0x15, 0x78, 0x09, 0x03, 0x7d, 0x37, 0x3b, 0xef, 0xf4, 0x5e, 0xab,
+    0xa9, 0xa9, 0xa9, 0xdc, 0xbb, 0x77, 0x2f, 0x3b, 0xf5, 0x13, 0x5e, 0x7c, 0xf1, 0x45, 0xe8, 0xd1,
+    0xa3, 0x07, 0x60, 0x9b, 0x6b, 0x9a, 0x5f, 0xef, 0xd7, 0xaf, 0x1f, 0x0c, 0x18, 0x30, 0x00, 0xb0,
+    0xff, 0x82, 0x90, 0x90, 0x10, 0x56, 0x5f, 0x04, 0xd8, 0x9f, 0x01, 0x3b, 0x02, 0x98, 0xcd, 0xbd,
+    0x47, 0x45, 0x45, 0xc1, 0xfc, 0xf9, 0xf3, 0x61, 0xc9, 0x92, 0x25, 0xb0, 0x72, 0xe5, 0x4a, 0xd8,
+    0xb2, 0x65, 0x8b, 0x36, 0x25, 0x25, 0x45, 0x91, 0x9d, 0x9d, 0x2d, 0x15, 0x8b, 0xc5, 0xd5, 0xb7,
+    0x6e, 0xdd, 0x92, 0x54, 0x57, 0x57, 0xcb, 0xb1, 0x3f, 0xd0, 0x61, 0xdf, 0xd0, 0x80, 0x41, 0x5d,
+    0xa6, 0x50, 0x28, 0x6e, 0x63, 0xbf, 0x70, 0x11, 0x9f, 0x1f, 0x60, 0x85, 0x86, 0xa6, 0x6c, 0x7e,
+    0x12, 0x72, 0x28, 0xed, 0xc4, 0x47, 0xb0, 0x5a, 0x5b, 0x30, 0xb1, 0xd1, 0xc9, 0xc9, 0xa9, 0x81,
+    0x15, 0x83, 0x61, 0x96, 0x56, 0xef, 0xea, 0xea, 0x6a, 0x60, 0xeb, 0xe5, 0x59, 0x36, 0x8e, 0x41,
+    0x88, 0x05, 0x70, 0x29, 0xcb, 0xd6, 0x58, 0xf0, 0xc6, 0xc0, 0xfd, 0x13, 0x06, 0xa2, 0x1f, 0xd8,
+    0x3c, 0x2d, 0xf2, 0x0c, 0x3e, 0x4f, 0xc7, 0xff, 0xdb, 0x87, 0x1d, 0xfb, 0x26, 0x7c, 0x9f, 0x4f,
+    0x90, 0x31, 0xc8, 0x68, 0xe4, 0x14, 0x24, 0x5b, 0xbe, 0x33, 0x04, 0xd9, 0x13, 0xe9, 0xc2, 0x77,
+    0xdd, 0x5c, 0x5c, 0x5c, 0xf4, 0x6c, 0xbd, 0x3c, 0xcb, 0xc6, 0x51, 0x0f, 0x16, 0xc0, 0x25, 0x18,
+    0xf4, 0x2a, 0x59, 0xf0, 0x66, 0xba, 0x61, 0x47, 0x73, 0x0d, 0x3b, 0x1c, 0xb1, 0x9f, 0x9f, 0xdf,
+    0x79, 0x7c, 0x9e, 0xc1, 0x74, 0xc3, 0xdf, 0xd9, 0xe0, 0x40, 0xba, 0x11, 0x9e, 0x61, 0x00, 0x4c,
+    0x6c, 0x34, 0xb1, 0x81, 0x65, 0xdb, 0xf8, 0x58, 0x8f, 0xc1, 0xd9, 0x20, 0x6c, 0x2e, 0x9a, 0xd3,
+    0xa4, 0x61, 0x16, 0x8e, 0x94, 0xb3, 0x60, 0x8d, 0xc1, 0xbb, 0x12, 0x79, 0x2f, 0x55, 0x84, 0x41,
+    0x5b, 0x04, 0xd7, 0x30, 0x70, 0x8b, 0xf1, 0xdf, 0xb9, 0xf8, 0xfc, 0x04, 0x0b, 0xe0, 0xf8, 0x7a,
+    0x32, 0xcb, 0xd0, 0x33, 0x0a, 0x61, 0x39, 0x06, 0xee, 0xc5, 0x99, 0x22, 0x98, 0x9d, 0x59, 0x04,
+    0x33, 0xf0, 0x3d, 0x27, 0xe2, 0x7b, 0x86, 0xa6, 0x5f, 0x86, 0xc1, 0xc2, 0x8b, 0xd0, 0xeb, 0xdb,
+    0x4b, 0x8e, 0xb3, 0x3e, 0xbc, 0x45, 0xce, 0xc3, 0xce, 0xc0, 0x61, 0x31, 0xda, 0x88, 0xa8, 0x63,
+    0x89, 0xb8, 0xc1, 0x60, 0xd0, 0x62, 0x36, 0xce, 0x2a, 0xe9, 0xe5, 0x1a, 0x8d, 0xa6, 0x1a, 0x0d,
+    0x7d, 0x05, 0x06, 0xef, 0x12, 0x0c, 0xde, 0x37, 0x24, 0x12, 0xc9, 0xd5, 0x07, 0x0f, 0x1e, 0x14,
+    0x20, 0x73, 0xd0, 0x40, 0xa4, 0xaa, 0xd5, 0xea, 0xdd, 0xf8, 0x1e, 0xeb, 0x90, 0xcb, 0x90, 0x1f,
+    0x20, 0xdf, 0x41, 0x86, 0x23, 0x43, 0x59, 0xf6, 0x8e, 0xf4, 0xa1, 0x6f, 0x35, 0x81, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0x43, 0xe1, 0xff, 0x00, 0x77, 0xf0,
+    0x5c, 0xc6, 0x9e, 0x53, 0x71, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82,
+};
+
+#endif // GATE_ATLAS_DATA_H
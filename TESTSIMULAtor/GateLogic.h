@@ -0,0 +1,210 @@
+#ifndef GATE_LOGIC_H
+#define GATE_LOGIC_H
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// ================================
+// GATE LOGIC (no raylib dependency)
+// ================================
+
+// Shared by the interactive gates and the compiled netlists, so the editor and
+// headless tools always agree on what a gate does.
+enum class GateType {
+    INPUT, OUTPUT, AND, OR, NOT, NAND, NOR, SUBCIRCUIT,
+    CLOCK, DFF, REGISTER,
+    LUT     // Compiled netlists only (see MapLuts); never placed
+};
+
+// Signal values. An N-bit bus carries lane i in bit i of one word, so a single
+// wire and a single evaluation move the whole bus; one-bit signals use bit 0.
+typedef unsigned long long BusWord;
+const int MAX_BUS_WIDTH = 64;
+
+// Lanes in use for a bus width
+inline BusWord BusMask(int width) {
+    return width >= MAX_BUS_WIDTH ? ~0ULL : ((1ULL << width) - 1);
+}
+
+// Number of lanes set in a word
+inline int PopCount(BusWord word) {
+#ifdef _MSC_VER
+    return (int)__popcnt((unsigned int)word) + (int)__popcnt((unsigned int)(word >> 32));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+// Output of a primitive gate applied lane by lane (b is ignored by one-input gates)
+inline BusWord EvaluateWord(GateType type, BusWord a, BusWord b, BusWord mask) {
+    switch (type) {
+    case GateType::INPUT:
+    case GateType::OUTPUT:
+        return a & mask;
+    case GateType::AND:
+        return a & b & mask;
+    case GateType::OR:
+        return (a | b) & mask;
+    case GateType::NOT:
+        return ~a & mask;
+    case GateType::NAND:
+        return ~(a & b) & mask;
+    case GateType::NOR:
+        return ~(a | b) & mask;
+    default:
+        return 0;
+    }
+}
+
+// Four-valued signals add a second bit-plane, so a word still carries one
+// signal per lane and a bus is still one evaluation:
+//   value unknown
+//     0      0      0
+//     1      0      1
+//     1      1      X   driven, but to an unknown level
+//     0      1      Z   not driven (a floating input)
+// A gate reads Z as X and never drives Z. X spreads pessimistically, one gate
+// at a time: an output lane is known only if it comes out the same whatever
+// the unknown inputs are (0 AND X = 0, 1 AND X = X).
+struct LogicWord {
+    BusWord value;
+    BusWord unknown;
+};
+
+// Output of a primitive gate on four-valued signals. Works on rails: lanes
+// that could be high and lanes that could be low (both for X and Z).
+inline LogicWord EvaluateFourValued(GateType type, LogicWord a, LogicWord b, BusWord mask) {
+    BusWord aHigh = a.value | a.unknown, aLow = ~a.value | a.unknown;
+    BusWord bHigh = b.value | b.unknown, bLow = ~b.value | b.unknown;
+    BusWord high, low;
+    switch (type) {
+    case GateType::INPUT:
+    case GateType::OUTPUT:
+        return { a.value & mask, a.unknown & mask };
+    case GateType::AND:
+        high = aHigh & bHigh;
+        low = aLow | bLow;
+        break;
+    case GateType::OR:
+        high = aHigh | bHigh;
+        low = aLow & bLow;
+        break;
+    case GateType::NOT:
+        high = aLow;
+        low = aHigh;
+        break;
+    case GateType::NAND:
+        high = aLow | bLow;
+        low = aHigh & bHigh;
+        break;
+    case GateType::NOR:
+        high = aLow & bLow;
+        low = aHigh | bHigh;
+        break;
+    default:
+        return { 0, 0 };
+    }
+    return { high & mask, high & low & mask };
+}
+
+// Clocked gates hold their output as state. Simulation is cycle based: one
+// tick is one clock cycle, and every clocked gate loads its next state at the
+// same instant at the end of the cycle (see NextState), so there is no clock
+// net to wire up and no event scheduling.
+//   CLOCK     no inputs; toggles every cycle (a square wave at half the tick rate)
+//   DFF       D; loads D every cycle
+//   REGISTER  D, EN; loads D in the lanes where EN is high and holds the rest
+inline bool IsClocked(GateType type) {
+    return type == GateType::CLOCK || type == GateType::DFF || type == GateType::REGISTER;
+}
+
+// State of a clocked gate after the clock edge, from its state q and inputs d and enable
+inline BusWord NextState(GateType type, BusWord q, BusWord d, BusWord enable, BusWord mask) {
+    switch (type) {
+    case GateType::CLOCK:
+        return ~q & mask;
+    case GateType::DFF:
+        return d & mask;
+    case GateType::REGISTER:
+        return ((d & enable) | (q & ~enable)) & mask;
+    default:
+        return q;
+    }
+}
+
+// NextState on four-valued signals: an unknown enable loads a lane only if D and Q agree there
+inline LogicWord NextStateFourValued(GateType type, LogicWord q, LogicWord d, LogicWord enable, BusWord mask) {
+    BusWord qHigh = q.value | q.unknown, qLow = ~q.value | q.unknown;
+    BusWord dHigh = d.value | d.unknown, dLow = ~d.value | d.unknown;
+    BusWord enHigh = enable.value | enable.unknown, enLow = ~enable.value | enable.unknown;
+    BusWord high, low;
+    switch (type) {
+    case GateType::CLOCK:
+        high = qLow;
+        low = qHigh;
+        break;
+    case GateType::DFF:
+        high = dHigh;
+        low = dLow;
+        break;
+    case GateType::REGISTER:
+        high = (enHigh & dHigh) | (enLow & qHigh);
+        low = (enHigh & dLow) | (enLow & qLow);
+        break;
+    default:
+        return q;
+    }
+    return { high & mask, high & low & mask };
+}
+
+// Output of a one-bit primitive gate for inputs a and b
+inline bool EvaluateGate(GateType type, bool a, bool b) {
+    return EvaluateWord(type, a ? 1 : 0, b ? 1 : 0, 1) != 0;
+}
+
+// Pin counts of a primitive gate (subcircuits take theirs from the definition)
+inline int PrimitiveInputCount(GateType type) {
+    switch (type) {
+    case GateType::INPUT:
+    case GateType::CLOCK:
+        return 0;
+    case GateType::OUTPUT:
+    case GateType::NOT:
+    case GateType::DFF:
+        return 1;
+    case GateType::AND:
+    case GateType::OR:
+    case GateType::NAND:
+    case GateType::NOR:
+    case GateType::REGISTER:
+        return 2;
+    default:
+        return 0;
+    }
+}
+
+inline int PrimitiveOutputCount(GateType type) {
+    return (type == GateType::OUTPUT || type == GateType::SUBCIRCUIT) ? 0 : 1;
+}
+
+// Propagation delay of a primitive in nanoseconds, for static timing. AND and
+// OR cost an inverting gate plus an inverter; a clocked gate's delay is from
+// the clock edge to its output. Subcircuits use their definition's pathDelay.
+inline float GateDelay(GateType type) {
+    switch (type) {
+    case GateType::NOT:
+    case GateType::NAND:
+    case GateType::NOR:
+        return 1.0f;
+    case GateType::AND:
+    case GateType::OR:
+    case GateType::DFF:
+    case GateType::REGISTER:
+        return 2.0f;
+    default:
+        return 0.0f;
+    }
+}
+
+#endif // GATE_LOGIC_H
@@ -0,0 +1,161 @@
+#include "GeometryBuffer.h"
+#include "Constants.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+// ================================
+// GEOMETRY BUFFER IMPLEMENTATION
+// ================================
+
+// Destructor
+GeometryBuffer::~GeometryBuffer() {
+    Unload();
+}
+
+// Start a rebuild
+void GeometryBuffer::Begin(Texture2D atlas) {
+    texture = atlas;
+    positions.clear();
+    texcoords.clear();
+    colors.clear();
+}
+
+// Upload the rebuilt geometry, growing the GPU buffers if needed
+void GeometryBuffer::End() {
+    int count = GetVertexCount();
+    uploadedCount = 0;
+    if (count == 0) return;
+
+    if (vaoId == 0 || count > capacity) {
+        // Reallocate with headroom so small edits don't reallocate every rebuild
+        Unload();
+        capacity = count + count / 2;
+
+        vaoId = rlLoadVertexArray();
+        rlEnableVertexArray(vaoId);
+
+        vboPositions = rlLoadVertexBuffer(nullptr, capacity * 3 * (int)sizeof(float), true);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+
+        vboTexcoords = rlLoadVertexBuffer(nullptr, capacity * 2 * (int)sizeof(float), true);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+
+        vboColors = rlLoadVertexBuffer(nullptr, capacity * 4, true);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, true, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+
+        rlDisableVertexArray();
+    }
+
+    rlUpdateVertexBuffer(vboPositions, positions.data(), count * 3 * (int)sizeof(float), 0);
+    rlUpdateVertexBuffer(vboTexcoords, texcoords.data(), count * 2 * (int)sizeof(float), 0);
+    rlUpdateVertexBuffer(vboColors, colors.data(), count * 4, 0);
+    uploadedCount = count;
+}
+
+// Submit the uploaded geometry in one draw call
+void GeometryBuffer::Draw() const {
+    if (uploadedCount == 0 || vaoId == 0) return;
+
+    // Flush raylib's own batch first so draw order is preserved
+    rlDrawRenderBatchActive();
+
+    rlEnableShader(rlGetShaderIdDefault());
+    int* locs = rlGetShaderLocsDefault();
+
+    Matrix mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+    rlSetUniformMatrix(locs[RL_SHADER_LOC_MATRIX_MVP], mvp);
+
+    float diffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    rlSetUniform(locs[RL_SHADER_LOC_COLOR_DIFFUSE], diffuse, RL_SHADER_UNIFORM_VEC4, 1);
+
+    int textureSlot = 0;
+    rlSetUniform(locs[RL_SHADER_LOC_MAP_DIFFUSE], &textureSlot, RL_SHADER_UNIFORM_INT, 1);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(texture.id != 0 ? texture.id : rlGetTextureIdDefault());
+
+    rlEnableVertexArray(vaoId);
+    rlDrawVertexArray(0, uploadedCount);
+    rlDisableVertexArray();
+
+    rlDisableTexture();
+    rlDisableShader();
+}
+
+// Release the GPU buffers
+void GeometryBuffer::Unload() {
+    if (vaoId == 0) return;
+    rlUnloadVertexBuffer(vboPositions);
+    rlUnloadVertexBuffer(vboTexcoords);
+    rlUnloadVertexBuffer(vboColors);
+    rlUnloadVertexArray(vaoId);
+    vaoId = vboPositions = vboTexcoords = vboColors = 0;
+    capacity = 0;
+    uploadedCount = 0;
+}
+
+void GeometryBuffer::PushVertex(Vector2 position, float u, float v, Color color) {
+    positions.push_back(position.x);
+    positions.push_back(position.y);
+    positions.push_back(0.0f);
+    texcoords.push_back(u);
+    texcoords.push_back(v);
+    colors.push_back(color.r);
+    colors.push_back(color.g);
+    colors.push_back(color.b);
+    colors.push_back(color.a);
+}
+
+// Two triangles covering p0-p1-p2-p3 (clockwise from top-left of the source)
+void GeometryBuffer::AddQuad(Vector2 p0, Vector2 p1, Vector2 p2, Vector2 p3, Rectangle source, Color color) {
+    float width = (texture.width > 0) ? (float)texture.width : 1.0f;
+    float height = (texture.height > 0) ? (float)texture.height : 1.0f;
+    float u0 = source.x / width;
+    float v0 = source.y / height;
+    float u1 = (source.x + source.width) / width;
+    float v1 = (source.y + source.height) / height;
+
+    PushVertex(p0, u0, v0, color);
+    PushVertex(p3, u0, v1, color);
+    PushVertex(p1, u1, v0, color);
+
+    PushVertex(p1, u1, v0, color);
+    PushVertex(p3, u0, v1, color);
+    PushVertex(p2, u1, v1, color);
+}
+
+void GeometryBuffer::AddSprite(Rectangle dest, Rectangle source, Color color) {
+    AddQuad({ dest.x, dest.y }, { dest.x + dest.width, dest.y },
+        { dest.x + dest.width, dest.y + dest.height }, { dest.x, dest.y + dest.height },
+        source, color);
+}
+
+void GeometryBuffer::AddRectangle(Rectangle dest, Color color) {
+    AddSprite(dest, ATLAS_WHITE_RECT, color);
+}
+
+void GeometryBuffer::AddRectangleLines(Rectangle rect, float thick, Color color) {
+    AddRectangle({ rect.x, rect.y, rect.width, thick }, color);
+    AddRectangle({ rect.x, rect.y + rect.height - thick, rect.width, thick }, color);
+    AddRectangle({ rect.x, rect.y + thick, thick, rect.height - 2 * thick }, color);
+    AddRectangle({ rect.x + rect.width - thick, rect.y + thick, thick, rect.height - 2 * thick }, color);
+}
+
+// Thick line as a quad oriented along the segment
+void GeometryBuffer::AddLine(Vector2 start, Vector2 end, float thick, Color color) {
+    Vector2 delta = Vector2Subtract(end, start);
+    float length = Vector2Length(delta);
+    if (length <= 0.0f) return;
+
+    Vector2 normal = { -delta.y / length * thick * 0.5f, delta.x / length * thick * 0.5f };
+    AddQuad(Vector2Add(start, normal), Vector2Add(end, normal),
+        Vector2Subtract(end, normal), Vector2Subtract(start, normal),
+        ATLAS_WHITE_RECT, color);
+}
+
+// Filled circle from the anti-aliased disc sprite
+void GeometryBuffer::AddDisc(Vector2 center, float radius, Color color) {
+    AddSprite({ center.x - radius, center.y - radius, radius * 2, radius * 2 }, ATLAS_DISC_RECT, color);
+}
@@ -0,0 +1,61 @@
+#ifndef GEOMETRY_BUFFER_H
+#define GEOMETRY_BUFFER_H
+
+#include "raylib.h"
+#include <vector>
+
+// ================================
+// GEOMETRY BUFFER DECLARATION
+// ================================
+
+// CPU-side triangle list mirrored into a dynamic vertex buffer through rlgl.
+// Everything in one buffer samples the same texture (the gate atlas), so the
+// whole buffer goes to the GPU in a single draw call. Fill it between Begin()
+// and End(), then Draw() it every frame until something changes.
+class GeometryBuffer {
+private:
+    Texture2D texture = { 0 };
+    std::vector<float> positions;       // x, y, z per vertex
+    std::vector<float> texcoords;       // u, v per vertex
+    std::vector<unsigned char> colors;  // r, g, b, a per vertex
+
+    unsigned int vaoId = 0;
+    unsigned int vboPositions = 0;
+    unsigned int vboTexcoords = 0;
+    unsigned int vboColors = 0;
+    int capacity = 0;       // Vertices the GPU buffers can hold
+    int uploadedCount = 0;  // Vertices currently on the GPU
+
+    void PushVertex(Vector2 position, float u, float v, Color color);
+
+public:
+    GeometryBuffer() = default;
+    ~GeometryBuffer();
+
+    GeometryBuffer(const GeometryBuffer&) = delete;
+    GeometryBuffer& operator=(const GeometryBuffer&) = delete;
+
+    // Start a rebuild; source rectangles passed to the Add* calls are in pixels of this texture
+    void Begin(Texture2D atlas);
+
+    // Upload the rebuilt geometry, growing the GPU buffers if needed
+    void End();
+
+    // Submit the uploaded geometry in one draw call
+    void Draw() const;
+
+    // Release the GPU buffers
+    void Unload();
+
+    int GetVertexCount() const { return (int)(positions.size() / 3); }
+
+    // Geometry helpers
+    void AddQuad(Vector2 p0, Vector2 p1, Vector2 p2, Vector2 p3, Rectangle source, Color color);
+    void AddSprite(Rectangle dest, Rectangle source, Color color);
+    void AddRectangle(Rectangle dest, Color color);
+    void AddRectangleLines(Rectangle rect, float thick, Color color);
+    void AddLine(Vector2 start, Vector2 end, float thick, Color color);
+    void AddDisc(Vector2 center, float radius, Color color);
+};
+
+#endif // GEOMETRY_BUFFER_H
@@ -0,0 +1,92 @@
+#ifndef LOCK_FREE_H
+#define LOCK_FREE_H
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+// ================================
+// SINGLE-PRODUCER QUEUE
+// ================================
+
+// Bounded ring for one producer thread and one consumer thread. Neither side
+// ever blocks: Push fails when the ring is full and Pop when it is empty.
+template <typename T>
+class SpscQueue {
+private:
+    std::vector<T> slots;
+    size_t mask;
+
+    // Kept on separate cache lines so the two threads don't fight over one
+    std::atomic<size_t> head{ 0 };       // Next slot to pop (consumer)
+    char headPadding[64];
+    std::atomic<size_t> tail{ 0 };       // Next slot to push (producer)
+    char tailPadding[64];
+
+public:
+    // Capacity is rounded up to a power of two
+    explicit SpscQueue(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        slots.resize(size);
+        mask = size - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer side; false if the ring is full, in which case item is left untouched
+    bool Push(T&& item) {
+        size_t position = tail.load(std::memory_order_relaxed);
+        if (position - head.load(std::memory_order_acquire) == slots.size()) return false;
+        slots[position & mask] = std::move(item);
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side; false if the ring is empty
+    bool Pop(T& item) {
+        size_t position = head.load(std::memory_order_relaxed);
+        if (position == tail.load(std::memory_order_acquire)) return false;
+        item = std::move(slots[position & mask]);
+        slots[position & mask] = T();    // Drop anything the item owned
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+// ================================
+// TRIPLE BUFFER
+// ================================
+
+// Hands the newest value from one writer thread to one reader thread. The
+// writer fills Back() and publishes it; the reader refreshes and reads Front().
+// Each side always owns one buffer outright and the third is swapped through
+// an atomic, so neither side waits and the reader never sees a torn value.
+template <typename T>
+class TripleBuffer {
+private:
+    static const unsigned FRESH = 4;     // Set on the middle index when it holds unread data
+
+    T buffers[3];
+    std::atomic<unsigned> middle{ 1 };
+    unsigned back = 0;                   // Writer's buffer
+    unsigned front = 2;                  // Reader's buffer
+
+public:
+    // Writer side
+    T& Back() { return buffers[back]; }
+    void Publish() {
+        back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & 3;
+    }
+
+    // Reader side: take the newest published buffer; false if nothing new
+    bool Refresh() {
+        if (!(middle.load(std::memory_order_acquire) & FRESH)) return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & 3;
+        return true;
+    }
+    const T& Front() const { return buffers[front]; }
+};
+
+#endif // LOCK_FREE_H
@@ -0,0 +1,662 @@
+#include "Netlist.h"
+#include <algorithm>
+#include <cstdlib>
+
+// Definitions available to the editor
+SubcircuitLibrary SUBCIRCUITS;
+
+// ================================
+// NETLIST COMPILER
+// ================================
+
+// Nets whose words fit in an L1 data cache, for judging whether reads stay local
+static const int LOCAL_NETS = 32 * 1024 / (int)sizeof(BusWord);
+
+// Lower a description to nets and ops in dependency order
+CompiledCircuit CompileCircuit(const CircuitDescription& description, const SubcircuitLibrary& library,
+    EvaluationOrder evaluationOrder) {
+    CompiledCircuit circuit;
+    circuit.name = description.name;
+    const int nodeCount = (int)description.nodes.size();
+
+    // Pin counts, bus widths and the first output net of every node
+    std::vector<int> inputCounts(nodeCount), outputCounts(nodeCount), firstOutputNet(nodeCount), widths(nodeCount);
+    for (int n = 0; n < nodeCount; n++) {
+        const NetlistNode& node = description.nodes[n];
+        widths[n] = std::min(std::max(node.width, 1), MAX_BUS_WIDTH);
+        const CompiledCircuit* definition = (node.type == GateType::SUBCIRCUIT) ? library.Get(node.definition) : nullptr;
+        inputCounts[n] = definition ? (int)definition->inputNets.size() : PrimitiveInputCount(node.type);
+        outputCounts[n] = definition ? (int)definition->outputNets.size() : PrimitiveOutputCount(node.type);
+        firstOutputNet[n] = circuit.netCount;
+        circuit.netCount += outputCounts[n];
+    }
+
+    // Net feeding every input pin (net 0 if unconnected)
+    std::vector<int> firstInputPin(nodeCount + 1, 0);
+    for (int n = 0; n < nodeCount; n++) {
+        firstInputPin[n + 1] = firstInputPin[n] + inputCounts[n];
+    }
+    std::vector<int> inputDriver(firstInputPin[nodeCount], 0);
+    std::vector<std::vector<int>> fanout(nodeCount);
+    std::vector<int> pendingInputs(nodeCount, 0);
+    for (const NetlistEdge& edge : description.edges) {
+        if (edge.fromNode < 0 || edge.fromNode >= nodeCount || edge.toNode < 0 || edge.toNode >= nodeCount) continue;
+        if (edge.fromPort < 0 || edge.fromPort >= outputCounts[edge.fromNode]) continue;
+        if (edge.toPort < 0 || edge.toPort >= inputCounts[edge.toNode]) continue;
+
+        inputDriver[firstInputPin[edge.toNode] + edge.toPort] = firstOutputNet[edge.fromNode] + edge.fromPort;
+
+        // A clocked gate's output is state from the last cycle, so it orders like an input
+        // and a loop through one is not a combinational cycle
+        if (IsClocked(description.nodes[edge.fromNode].type)) continue;
+        fanout[edge.fromNode].push_back(edge.toNode);
+        pendingInputs[edge.toNode]++;
+    }
+
+    // Topological order (Kahn); whatever is left over sits on a feedback loop
+    std::vector<int> order;
+    order.reserve(nodeCount);
+    std::vector<char> placed(nodeCount, 0);
+    for (int n = 0; n < nodeCount; n++) {
+        if (pendingInputs[n] == 0) {
+            order.push_back(n);
+            placed[n] = 1;
+        }
+    }
+    for (size_t head = 0; head < order.size(); head++) {
+        for (int next : fanout[order[head]]) {
+            if (--pendingInputs[next] == 0) {
+                order.push_back(next);
+                placed[next] = 1;
+            }
+        }
+    }
+    if ((int)order.size() < nodeCount) circuit.hasCycle = true;
+    std::vector<int> levelOrder = order;
+    for (int n = 0; n < nodeCount; n++) {
+        if (!placed[n]) levelOrder.push_back(n);
+    }
+
+    // Kahn's order goes level by level, so a gate's drivers may have been
+    // evaluated long before it. Any topological order gives the same results, so
+    // also try depth first from the sinks: each node comes straight after the
+    // drivers it reads, while their values are still in cache. Clocked gates'
+    // outputs are state, read like inputs, so they aren't expanded through.
+    // Nodes on a feedback loop keep node order at the end.
+    std::vector<int> netNode(circuit.netCount, -1);
+    for (int n = 0; n < nodeCount; n++) {
+        for (int o = 0; o < outputCounts[n]; o++) netNode[firstOutputNet[n] + o] = n;
+    }
+    order.clear();
+    std::vector<char> expanded(nodeCount, 0), emitted(nodeCount, 0);
+    std::vector<std::pair<int, int>> stack;     // (node, next input pin to follow)
+    auto expand = [&](int root) {
+        expanded[root] = 1;
+        stack.push_back(std::make_pair(root, 0));
+        while (!stack.empty()) {
+            int node = stack.back().first;
+            if (stack.back().second < inputCounts[node]) {
+                int driver = netNode[inputDriver[firstInputPin[node] + stack.back().second++]];
+                if (driver < 0 || !placed[driver] || expanded[driver] || emitted[driver]) continue;
+                if (IsClocked(description.nodes[driver].type)) {
+                    emitted[driver] = 1;
+                    order.push_back(driver);
+                    continue;
+                }
+                expanded[driver] = 1;
+                stack.push_back(std::make_pair(driver, 0));
+                continue;
+            }
+            stack.pop_back();
+            if (!emitted[node]) {
+                emitted[node] = 1;
+                order.push_back(node);
+            }
+        }
+    };
+    for (int n = 0; n < nodeCount; n++) {
+        if (placed[n] && description.nodes[n].type == GateType::OUTPUT) expand(n);
+    }
+    for (int n = 0; n < nodeCount; n++) {
+        if (placed[n] && !expanded[n] && IsClocked(description.nodes[n].type)) expand(n);
+    }
+    for (int n = 0; n < nodeCount; n++) {
+        if (placed[n] && !expanded[n] && !emitted[n]) expand(n);
+    }
+    for (int n = 0; n < nodeCount; n++) {
+        if (!placed[n]) order.push_back(n);
+    }
+
+    // Number nets in that order too, so reads land near the writes just before them
+    std::vector<int> renumber(circuit.netCount, 0);
+    int nextNet = 1;
+    for (int n : order) {
+        for (int o = 0; o < outputCounts[n]; o++) renumber[firstOutputNet[n] + o] = nextNet + o;
+        nextNet += outputCounts[n];
+    }
+
+    // Designs built a cone at a time (as on the canvas) are often local in node order
+    // already, and there the depth-first order only adds jumps between cones. Keep it
+    // only if it clearly cuts the far reads: nets an L1's worth from the op's own, or
+    // written more than an L1's worth of ops before.
+    std::vector<int> position(nodeCount, 0);
+    auto farReads = [&](const std::vector<int>& sequence, bool renumbered) {
+        for (int i = 0; i < (int)sequence.size(); i++) position[sequence[i]] = i;
+        size_t far = 0;
+        for (int n : sequence) {
+            if (outputCounts[n] == 0) continue;
+            int written = renumbered ? renumber[firstOutputNet[n]] : firstOutputNet[n];
+            for (int pin = firstInputPin[n]; pin < firstInputPin[n + 1]; pin++) {
+                int net = inputDriver[pin];
+                if (netNode[net] < 0) continue;
+                int read = renumbered ? renumber[net] : net;
+                if (std::abs(written - read) > LOCAL_NETS || position[n] - position[netNode[net]] > LOCAL_NETS) far++;
+            }
+        }
+        return far;
+    };
+
+    // The rule: go depth first only if that leaves fewer than 3/4 as many far reads.
+    // The count is only a proxy for cache misses, so near-ties keep the order the
+    // design was built in (and its net numbers) rather than gamble on a reshuffle.
+    // The designs in tools/orderbench.cpp are far from the line: the losing order has
+    // at least 4.3x the far reads (0 vs 3.1M for placed adders, 0.71M vs 0 for placed
+    // random logic), so any threshold from about 1/2 to 9/10 picks the same, and the
+    // pick is the faster order in all four.
+    bool depthFirst = (evaluationOrder == EvaluationOrder::DEPTH_FIRST) ||
+        (evaluationOrder == EvaluationOrder::AUTOMATIC && farReads(order, true) * 4 < farReads(levelOrder, false) * 3);
+    if (depthFirst) {
+        for (int n = 0; n < nodeCount; n++) firstOutputNet[n] = renumber[firstOutputNet[n]];
+        for (int& net : inputDriver) net = renumber[net];
+    }
+    else {
+        order.swap(levelOrder);
+    }
+
+    // Ports
+    for (int n = 0; n < nodeCount; n++) {
+        GateType type = description.nodes[n].type;
+        if (type == GateType::INPUT) {
+            circuit.inputNets.push_back(firstOutputNet[n]);
+            circuit.inputWidths.push_back(widths[n]);
+        }
+        if (type == GateType::OUTPUT) {
+            circuit.outputNets.push_back(inputDriver[firstInputPin[n]]);
+            circuit.outputWidths.push_back(widths[n]);
+        }
+    }
+
+    // Emit ops; INPUT and OUTPUT nodes are just port nets and clocked gates go
+    // to stateOps, in the same order
+    size_t nestedScratch = 0;
+    for (int n : order) {
+        const NetlistNode& node = description.nodes[n];
+        if (node.type == GateType::INPUT || node.type == GateType::OUTPUT) continue;
+
+        CompiledOp op;
+        op.type = node.type;
+        op.definition = node.definition;
+        op.firstPin = (int)circuit.pins.size();
+        op.inputCount = inputCounts[n];
+        op.outputCount = outputCounts[n];
+        op.mask = BusMask(widths[n]);
+        for (int i = 0; i < inputCounts[n]; i++) {
+            circuit.pins.push_back(inputDriver[firstInputPin[n] + i]);
+        }
+        for (int o = 0; o < outputCounts[n]; o++) {
+            circuit.pins.push_back(firstOutputNet[n] + o);
+        }
+        (IsClocked(node.type) ? circuit.stateOps : circuit.ops).push_back(op);
+
+        if (node.type == GateType::SUBCIRCUIT) {
+            const CompiledCircuit* definition = library.Get(node.definition);
+            if (definition) {
+                circuit.flattenedGates += definition->flattenedGates;
+                nestedScratch = std::max(nestedScratch, definition->scratchNets);
+            }
+        }
+        else {
+            circuit.flattenedGates += widths[n];
+        }
+    }
+
+    // Width of every net, from the pin that drives it
+    circuit.netWidths.assign(circuit.netCount, 1);
+    for (int n = 0; n < nodeCount; n++) {
+        const NetlistNode& node = description.nodes[n];
+        const CompiledCircuit* definition = (node.type == GateType::SUBCIRCUIT) ? library.Get(node.definition) : nullptr;
+        for (int o = 0; o < outputCounts[n]; o++) {
+            circuit.netWidths[firstOutputNet[n] + o] = definition ? definition->outputWidths[o] : widths[n];
+        }
+    }
+
+    // Longest path, one pass in op order (a combinational loop counts once around)
+    std::vector<float> arrival(circuit.netCount, 0.0f);
+    for (const CompiledOp& op : circuit.ops) {
+        const int* pin = &circuit.pins[op.firstPin];
+        float latest = 0;
+        for (int i = 0; i < op.inputCount; i++) latest = std::max(latest, arrival[pin[i]]);
+        const CompiledCircuit* definition = (op.type == GateType::SUBCIRCUIT) ? library.Get(op.definition) : nullptr;
+        float delay = definition ? definition->pathDelay : GateDelay(op.type);
+        for (int o = 0; o < op.outputCount; o++) arrival[pin[op.inputCount + o]] = latest + delay;
+    }
+    for (int net : circuit.outputNets) circuit.pathDelay = std::max(circuit.pathDelay, arrival[net]);
+
+    circuit.nodeOutputNets = std::move(firstOutputNet);
+    circuit.nodeInputPins = std::move(firstInputPin);
+    circuit.inputPinNets = std::move(inputDriver);
+    circuit.scratchNets = circuit.netCount + std::max(nestedScratch, circuit.stateOps.size());
+    return circuit;
+}
+
+// ================================
+// LUT MAPPING
+// ================================
+
+// Cuts kept per net; the few with the lowest area flow are nearly always enough
+static const size_t CUTS_PER_NET = 8;
+
+// Nets that between them decide another net's value
+struct LutCut {
+    int leaves[LUT_MAX_INPUTS];     // Ascending
+    int size = 0;
+    float flow = 0;                 // Area flow: LUTs the cone costs, shared out among the uses of its leaves
+};
+
+// Truth table of leaf i, when table index j assigns bit i of j to leaf i
+static const BusWord LEAF_TABLES[LUT_MAX_INPUTS] = {
+    0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+    0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL
+};
+
+// One-bit gates whose output depends only on their inputs this pass
+static bool IsLutCandidate(const CompiledOp& op) {
+    switch (op.type) {
+    case GateType::AND:
+    case GateType::OR:
+    case GateType::NOT:
+    case GateType::NAND:
+    case GateType::NOR:
+        return op.mask == 1;
+    default:
+        return false;
+    }
+}
+
+// Union of two cuts; false if it has too many leaves for one LUT
+static bool MergeCuts(const LutCut& a, const LutCut& b, LutCut& merged) {
+    merged.size = 0;
+    int i = 0, j = 0;
+    while (i < a.size || j < b.size) {
+        int leaf;
+        if (j == b.size || (i < a.size && a.leaves[i] < b.leaves[j])) leaf = a.leaves[i++];
+        else if (i == a.size || b.leaves[j] < a.leaves[i]) leaf = b.leaves[j++];
+        else {
+            leaf = a.leaves[i++];
+            j++;
+        }
+        if (merged.size == LUT_MAX_INPUTS) return false;
+        merged.leaves[merged.size++] = leaf;
+    }
+    return true;
+}
+
+static bool SameLeaves(const LutCut& a, const LutCut& b) {
+    return a.size == b.size && std::equal(a.leaves, a.leaves + a.size, b.leaves);
+}
+
+// Collapse one-bit gate cones into LUTs: enumerate the cuts of every net
+// bottom up, keep the few cheapest by area flow, then cover the nets that must
+// stay visible from the outputs back, one LUT per net with its cheapest cut
+size_t MapLuts(CompiledCircuit& circuit) {
+    circuit.mappedOps.clear();
+    circuit.mappedPins.clear();
+    circuit.truthTables.clear();
+    const std::vector<CompiledOp>& ops = circuit.ops;
+    const int opCount = (int)ops.size();
+    const int netCount = circuit.netCount;
+
+    // Op driving each net (-1 for input ports, clocked gates and the constant)
+    std::vector<int> producer(netCount, -1);
+    for (int i = 0; i < opCount; i++) {
+        const CompiledOp& op = ops[i];
+        for (int o = 0; o < op.outputCount; o++) producer[circuit.pins[op.firstPin + op.inputCount + o]] = i;
+    }
+
+    // Ops on a feedback loop read a net before it is written this pass, so they
+    // stay as they are; everything else sees only nets finished before it
+    std::vector<char> mappable(opCount, 0);
+    std::vector<int> uses(netCount, 0);
+    for (int i = 0; i < opCount; i++) {
+        const CompiledOp& op = ops[i];
+        const int* pin = &circuit.pins[op.firstPin];
+        bool ordered = true;
+        for (int k = 0; k < op.inputCount; k++) {
+            uses[pin[k]]++;
+            if (producer[pin[k]] >= i) ordered = false;
+        }
+        mappable[i] = IsLutCandidate(op) && ordered;
+    }
+
+    // Cuts of every mappable op's net, drivers first. A net is also a cut of
+    // itself (one leaf); that one is implied rather than stored.
+    std::vector<std::vector<LutCut>> cuts(netCount);
+    std::vector<float> netFlow(netCount, 0.0f);
+    std::vector<LutCut> choices[2];
+    for (int i = 0; i < opCount; i++) {
+        if (!mappable[i]) continue;
+        const CompiledOp& op = ops[i];
+        const int* pin = &circuit.pins[op.firstPin];
+        for (int k = 0; k < op.inputCount; k++) {
+            choices[k] = cuts[pin[k]];
+            LutCut self;
+            self.leaves[0] = pin[k];
+            self.size = 1;
+            choices[k].push_back(self);
+        }
+
+        std::vector<LutCut>& found = cuts[pin[op.inputCount]];
+        size_t secondCount = op.inputCount > 1 ? choices[1].size() : 1;
+        for (const LutCut& a : choices[0]) {
+            for (size_t b = 0; b < secondCount; b++) {
+                LutCut cut = a;
+                if (op.inputCount > 1 && !MergeCuts(a, choices[1][b], cut)) continue;
+                bool seen = false;
+                for (const LutCut& other : found) seen = seen || SameLeaves(cut, other);
+                if (seen) continue;
+                cut.flow = 1.0f;
+                for (int l = 0; l < cut.size; l++) cut.flow += netFlow[cut.leaves[l]] / std::max(uses[cut.leaves[l]], 1);
+                found.push_back(cut);
+            }
+        }
+        std::sort(found.begin(), found.end(), [](const LutCut& a, const LutCut& b) {
+            return a.flow != b.flow ? a.flow < b.flow : a.size < b.size;
+        });
+        if (found.size() > CUTS_PER_NET) found.resize(CUTS_PER_NET);
+        netFlow[pin[op.inputCount]] = found[0].flow;
+    }
+
+    // Nets that must be computed: whatever ports, clocked gates and unmapped
+    // ops read, then the leaves of each LUT chosen for them, outputs back
+    std::vector<char> required(netCount, 0);
+    for (int net : circuit.outputNets) required[net] = 1;
+    for (const CompiledOp& op : circuit.stateOps) {
+        for (int k = 0; k < op.inputCount; k++) required[circuit.pins[op.firstPin + k]] = 1;
+    }
+    for (int i = 0; i < opCount; i++) {
+        if (mappable[i]) continue;
+        for (int k = 0; k < ops[i].inputCount; k++) required[circuit.pins[ops[i].firstPin + k]] = 1;
+    }
+    for (int i = opCount - 1; i >= 0; i--) {
+        int out = circuit.pins[ops[i].firstPin + ops[i].inputCount];
+        if (!mappable[i] || !required[out]) continue;
+        const LutCut& cut = cuts[out][0];
+        for (int l = 0; l < cut.size; l++) required[cut.leaves[l]] = 1;
+    }
+
+    // Emit in op order. A LUT's table comes from running its cone once with
+    // every leaf assignment side by side in the lanes of a word.
+    std::vector<BusWord> tables(netCount, 0);
+    std::vector<int> visited(netCount, -1);
+    std::vector<int> cone, stack;
+    size_t lutCount = 0;
+    for (int i = 0; i < opCount; i++) {
+        CompiledOp op = ops[i];
+        const int* pin = &circuit.pins[op.firstPin];
+        int out = pin[op.inputCount];
+        if (mappable[i]) {
+            if (!required[out]) continue;   // Only ever read inside LUTs
+
+            const LutCut& cut = cuts[out][0];
+            for (int l = 0; l < cut.size; l++) {
+                visited[cut.leaves[l]] = i;
+                tables[cut.leaves[l]] = LEAF_TABLES[l];
+            }
+            cone.clear();
+            stack.assign(1, out);
+            while (!stack.empty()) {
+                int net = stack.back();
+                stack.pop_back();
+                if (visited[net] == i) continue;
+                visited[net] = i;
+                const CompiledOp& inner = ops[producer[net]];
+                cone.push_back(producer[net]);
+                for (int k = 0; k < inner.inputCount; k++) stack.push_back(circuit.pins[inner.firstPin + k]);
+            }
+
+            if (cone.size() > 1) {
+                std::sort(cone.begin(), cone.end());
+                for (int c : cone) {
+                    const CompiledOp& inner = ops[c];
+                    const int* innerPin = &circuit.pins[inner.firstPin];
+                    BusWord a = tables[innerPin[0]];
+                    BusWord b = inner.inputCount > 1 ? tables[innerPin[1]] : 0;
+                    tables[innerPin[inner.inputCount]] = EvaluateWord(inner.type, a, b, ~0ULL);
+                }
+                CompiledOp lut = op;
+                lut.type = GateType::LUT;
+                lut.definition = (int)circuit.truthTables.size();
+                lut.firstPin = (int)circuit.mappedPins.size();
+                lut.inputCount = cut.size;
+                circuit.mappedPins.insert(circuit.mappedPins.end(), cut.leaves, cut.leaves + cut.size);
+                circuit.mappedPins.push_back(out);
+                circuit.mappedOps.push_back(lut);
+                circuit.truthTables.push_back(tables[out]);
+                lutCount++;
+                continue;
+            }
+        }
+
+        // Kept as it is (a LUT of one gate would only be slower)
+        op.firstPin = (int)circuit.mappedPins.size();
+        circuit.mappedPins.insert(circuit.mappedPins.end(), pin, pin + op.inputCount + op.outputCount);
+        circuit.mappedOps.push_back(op);
+    }
+
+    if (lutCount == 0) {
+        circuit.mappedOps.clear();
+        circuit.mappedPins.clear();
+    }
+    return lutCount;
+}
+
+// ================================
+// SUBCIRCUIT LIBRARY IMPLEMENTATION
+// ================================
+
+// Constructor - every slot up front, so adding never moves a definition
+SubcircuitLibrary::SubcircuitLibrary() : definitions(MAX_SUBCIRCUITS), descriptions(MAX_SUBCIRCUITS) {
+}
+
+// Compile and add a definition; it becomes visible to other threads once count is bumped
+int SubcircuitLibrary::Add(const CircuitDescription& description) {
+    int id = count.load(std::memory_order_relaxed);
+    if (id >= MAX_SUBCIRCUITS) return -1;
+    for (const NetlistNode& node : description.nodes) {
+        if (IsClocked(node.type)) return -1;
+    }
+    // Only an instance's ports are ever read, so its gates can be folded into LUTs
+    CompiledCircuit* compiled = new CompiledCircuit(CompileCircuit(description, *this));
+    MapLuts(*compiled);
+    definitions[id].reset(compiled);
+    descriptions[id] = description;
+    count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+// Same name, nodes and edges, in the same order
+static bool SameDescription(const CircuitDescription& a, const CircuitDescription& b) {
+    if (a.name != b.name || a.nodes.size() != b.nodes.size() || a.edges.size() != b.edges.size()) return false;
+    for (size_t n = 0; n < a.nodes.size(); n++) {
+        const NetlistNode& x = a.nodes[n];
+        const NetlistNode& y = b.nodes[n];
+        if (x.type != y.type || x.definition != y.definition || x.width != y.width) return false;
+    }
+    for (size_t e = 0; e < a.edges.size(); e++) {
+        const NetlistEdge& x = a.edges[e];
+        const NetlistEdge& y = b.edges[e];
+        if (x.fromNode != y.fromNode || x.fromPort != y.fromPort || x.toNode != y.toNode || x.toPort != y.toPort) return false;
+    }
+    return true;
+}
+
+int SubcircuitLibrary::Find(const CircuitDescription& description) const {
+    for (int id = 0; id < Count(); id++) {
+        if (SameDescription(descriptions[id], description)) return id;
+    }
+    return -1;
+}
+
+const CompiledCircuit* SubcircuitLibrary::Get(int id) const {
+    if (id < 0 || id >= Count()) return nullptr;
+    return definitions[id].get();
+}
+
+const CircuitDescription* SubcircuitLibrary::GetDescription(int id) const {
+    if (id < 0 || id >= Count()) return nullptr;
+    return &descriptions[id];
+}
+
+// Evaluate one instance
+void SubcircuitLibrary::Evaluate(int id, const BusWord* inputs, BusWord* outputs) const {
+    const CompiledCircuit* circuit = Get(id);
+    if (!circuit) return;
+
+    // Instances keep only their port values; internal nets live in scratch space
+    thread_local std::vector<BusWord> nets;
+    if (nets.size() < circuit->scratchNets) nets.resize(circuit->scratchNets);
+    std::fill(nets.begin(), nets.begin() + circuit->netCount, 0);
+
+    for (size_t i = 0; i < circuit->inputNets.size(); i++) {
+        nets[circuit->inputNets[i]] = inputs[i] & BusMask(circuit->inputWidths[i]);
+    }
+    EvaluateInto(*circuit, nets, 0);
+    for (size_t o = 0; o < circuit->outputNets.size(); o++) {
+        outputs[o] = nets[circuit->outputNets[o]];
+    }
+}
+
+// One clock cycle of a circuit kept outside the library
+void SubcircuitLibrary::Step(const CompiledCircuit& circuit, std::vector<BusWord>& nets) const {
+    if (nets.size() < circuit.scratchNets) nets.resize(circuit.scratchNets, 0);
+    EvaluateInto(circuit, nets, 0);
+    if (circuit.stateOps.empty()) return;
+
+    // Clock edge: every next state is worked out from the settled nets before any
+    // is stored (in the scratch words after the circuit's own), so flops that feed
+    // each other swap values rather than racing
+    BusWord* next = &nets[circuit.netCount];
+    for (size_t s = 0; s < circuit.stateOps.size(); s++) {
+        const CompiledOp& op = circuit.stateOps[s];
+        const int* pin = &circuit.pins[op.firstPin];
+        BusWord d = op.inputCount > 0 ? nets[pin[0]] : 0;
+        BusWord enable = op.inputCount > 1 ? nets[pin[1]] : 0;
+        next[s] = NextState(op.type, nets[pin[op.inputCount]], d, enable, op.mask);
+    }
+    for (size_t s = 0; s < circuit.stateOps.size(); s++) {
+        const CompiledOp& op = circuit.stateOps[s];
+        nets[circuit.pins[op.firstPin + op.inputCount]] = next[s];
+    }
+    EvaluateInto(circuit, nets, 0);
+}
+
+// One clock cycle on four-valued signals
+void SubcircuitLibrary::StepFourValued(const CompiledCircuit& circuit, std::vector<BusWord>& nets,
+    std::vector<BusWord>& unknown) const {
+    if (nets.size() < circuit.scratchNets) nets.resize(circuit.scratchNets, 0);
+    if (unknown.size() < circuit.scratchNets) unknown.resize(circuit.scratchNets, 0);
+    EvaluateFourValuedInto(circuit, nets, unknown, 0);
+    if (circuit.stateOps.empty()) return;
+
+    // Clock edge, as in Step, with the next states' planes side by side in the scratch words
+    BusWord* next = &nets[circuit.netCount];
+    BusWord* nextUnknown = &unknown[circuit.netCount];
+    for (size_t s = 0; s < circuit.stateOps.size(); s++) {
+        const CompiledOp& op = circuit.stateOps[s];
+        const int* pin = &circuit.pins[op.firstPin];
+        LogicWord q = { nets[pin[op.inputCount]], unknown[pin[op.inputCount]] };
+        LogicWord d = op.inputCount > 0 ? LogicWord{ nets[pin[0]], unknown[pin[0]] } : LogicWord{ 0, 0 };
+        LogicWord enable = op.inputCount > 1 ? LogicWord{ nets[pin[1]], unknown[pin[1]] } : LogicWord{ 0, 0 };
+        LogicWord state = NextStateFourValued(op.type, q, d, enable, op.mask);
+        next[s] = state.value;
+        nextUnknown[s] = state.unknown;
+    }
+    for (size_t s = 0; s < circuit.stateOps.size(); s++) {
+        const CompiledOp& op = circuit.stateOps[s];
+        int q = circuit.pins[op.firstPin + op.inputCount];
+        nets[q] = next[s];
+        unknown[q] = nextUnknown[s];
+    }
+    EvaluateFourValuedInto(circuit, nets, unknown, 0);
+}
+
+// Run a circuit's ops on nets[base ..); nested definitions use the space after it
+void SubcircuitLibrary::EvaluateInto(const CompiledCircuit& circuit, std::vector<BusWord>& nets, size_t base) const {
+    const bool mapped = !circuit.mappedOps.empty();
+    const std::vector<int>& pins = mapped ? circuit.mappedPins : circuit.pins;
+    for (const CompiledOp& op : mapped ? circuit.mappedOps : circuit.ops) {
+        const int* pin = &pins[op.firstPin];
+
+        if (op.type == GateType::LUT) {
+            unsigned index = 0;
+            for (int i = 0; i < op.inputCount; i++) index |= (unsigned)(nets[base + pin[i]] & 1) << i;
+            nets[base + pin[op.inputCount]] = (circuit.truthTables[op.definition] >> index) & 1;
+            continue;
+        }
+
+        if (op.type != GateType::SUBCIRCUIT) {
+            BusWord a = op.inputCount > 0 ? nets[base + pin[0]] : 0;
+            BusWord b = op.inputCount > 1 ? nets[base + pin[1]] : 0;
+            nets[base + pin[op.inputCount]] = EvaluateWord(op.type, a, b, op.mask);
+            continue;
+        }
+
+        const CompiledCircuit* child = Get(op.definition);
+        if (!child) continue;
+
+        size_t childBase = base + circuit.netCount;
+        std::fill(nets.begin() + childBase, nets.begin() + childBase + child->netCount, 0);
+        for (int i = 0; i < op.inputCount; i++) {
+            nets[childBase + child->inputNets[i]] = nets[base + pin[i]];
+        }
+        EvaluateInto(*child, nets, childBase);
+        for (int o = 0; o < op.outputCount; o++) {
+            nets[base + pin[op.inputCount + o]] = nets[childBase + child->outputNets[o]];
+        }
+    }
+}
+
+// EvaluateInto on both bit-planes; net 0 is left floating, so unconnected inputs read Z
+void SubcircuitLibrary::EvaluateFourValuedInto(const CompiledCircuit& circuit, std::vector<BusWord>& nets,
+    std::vector<BusWord>& unknown, size_t base) const {
+    nets[base] = 0;
+    unknown[base] = ~0ULL;
+    for (const CompiledOp& op : circuit.ops) {
+        const int* pin = &circuit.pins[op.firstPin];
+
+        if (op.type != GateType::SUBCIRCUIT) {
+            LogicWord a = op.inputCount > 0 ? LogicWord{ nets[base + pin[0]], unknown[base + pin[0]] } : LogicWord{ 0, 0 };
+            LogicWord b = op.inputCount > 1 ? LogicWord{ nets[base + pin[1]], unknown[base + pin[1]] } : LogicWord{ 0, 0 };
+            LogicWord out = EvaluateFourValued(op.type, a, b, op.mask);
+            nets[base + pin[op.inputCount]] = out.value;
+            unknown[base + pin[op.inputCount]] = out.unknown;
+            continue;
+        }
+
+        const CompiledCircuit* child = Get(op.definition);
+        if (!child) continue;
+
+        size_t childBase = base + circuit.netCount;
+        std::fill(nets.begin() + childBase, nets.begin() + childBase + child->netCount, 0);
+        std::fill(unknown.begin() + childBase, unknown.begin() + childBase + child->netCount, 0);
+        for (int i = 0; i < op.inputCount; i++) {
+            nets[childBase + child->inputNets[i]] = nets[base + pin[i]];
+            unknown[childBase + child->inputNets[i]] = unknown[base + pin[i]];
+        }
+        EvaluateFourValuedInto(*child, nets, unknown, childBase);
+        for (int o = 0; o < op.outputCount; o++) {
+            nets[base + pin[op.inputCount + o]] = nets[childBase + child->outputNets[o]];
+            unknown[base + pin[op.inputCount + o]] = unknown[childBase + child->outputNets[o]];
+        }
+    }
+}
@@ -0,0 +1,163 @@
+#ifndef NETLIST_H
+#define NETLIST_H
+
+#include "GateLogic.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <cstddef>
+
+// ================================
+// NETLIST DESCRIPTION
+// ================================
+
+// Plain description of a circuit: nodes and the wires between their pins.
+// INPUT nodes become input ports and OUTPUT nodes output ports, numbered in
+// node order.
+struct NetlistNode {
+    GateType type = GateType::AND;
+    int definition = -1;        // SUBCIRCUIT only: id in the SubcircuitLibrary
+    int width = 1;              // Bus width of a primitive node (1 to MAX_BUS_WIDTH)
+};
+
+struct NetlistEdge {
+    int fromNode;
+    int fromPort;               // Output pin of fromNode
+    int toNode;
+    int toPort;                 // Input pin of toNode
+};
+
+struct CircuitDescription {
+    std::string name;
+    std::vector<NetlistNode> nodes;
+    std::vector<NetlistEdge> edges;
+};
+
+// ================================
+// COMPILED CIRCUIT
+// ================================
+
+// One evaluation step. Its pins are pins[firstPin ..): inputCount input nets,
+// then outputCount output nets.
+struct CompiledOp {
+    GateType type;
+    int definition;
+    int firstPin;
+    int inputCount;
+    int outputCount;
+    BusWord mask;               // Lanes of a primitive op (BusMask of its width)
+};
+
+// A circuit lowered to nets and ops in dependency order. Every net holds one
+// BusWord, so a bus costs the same as a single wire. Net 0 is a constant
+// low that unconnected inputs read. Compiled once per definition and shared by
+// every instance; evaluation works in caller-provided scratch space.
+struct CompiledCircuit {
+    std::string name;
+    int netCount = 1;
+    std::vector<CompiledOp> ops;
+    std::vector<CompiledOp> stateOps;   // Clocked gates, updated together after ops: pins are inputs, then Q
+    std::vector<int> pins;
+    std::vector<int> inputNets;     // Net driven by input port i
+    std::vector<int> outputNets;    // Net read by output port i
+    std::vector<int> inputWidths;   // Bus width of input port i
+    std::vector<int> outputWidths;  // Bus width of output port i
+    std::vector<int> netWidths;     // Bus width of every net
+
+    // Where each description node ended up, for reading results back per node
+    std::vector<int> nodeOutputNets;    // First output net of node n
+    std::vector<int> nodeInputPins;     // Node n reads inputPinNets[nodeInputPins[n] .. nodeInputPins[n + 1])
+    std::vector<int> inputPinNets;
+
+    size_t flattenedGates = 0;      // One-bit primitive gates if fully flattened
+    float pathDelay = 0;            // Longest input-to-output delay in ns (see GateDelay)
+    size_t scratchNets = 1;         // Nets needed to evaluate, including nested definitions and next states
+    bool hasCycle = false;          // Combinational feedback loops are evaluated once, in node order
+
+    // Schedule after LUT mapping (see MapLuts): when set, evaluation runs these
+    // instead of ops. A LUT op's definition indexes truthTables. ops stay as
+    // compiled, so timing and checkpoints see the same circuit either way.
+    std::vector<CompiledOp> mappedOps;
+    std::vector<int> mappedPins;
+    std::vector<BusWord> truthTables;
+};
+
+class SubcircuitLibrary;
+
+// Order ops are evaluated and nets numbered in. LEVEL is Kahn's order with nets
+// numbered by node; DEPTH_FIRST runs each node straight after the drivers it reads,
+// with nets renumbered to match. AUTOMATIC takes whichever keeps reads closer.
+enum class EvaluationOrder { AUTOMATIC, LEVEL, DEPTH_FIRST };
+
+// Lower a description; nested SUBCIRCUIT nodes must already be in the library
+CompiledCircuit CompileCircuit(const CircuitDescription& description, const SubcircuitLibrary& library,
+    EvaluationOrder evaluationOrder = EvaluationOrder::AUTOMATIC);
+
+// Most inputs of one LUT: a BusWord holds the truth table of six
+const int LUT_MAX_INPUTS = 6;
+
+// Collapse cones of one-bit AND/OR/NOT/NAND/NOR ops into LUTs of up to
+// LUT_MAX_INPUTS inputs, each evaluated with one table lookup. Only nets read
+// by output ports, clocked gates and the ops left in place are still computed,
+// so map only circuits whose other nets nobody reads (library definitions and
+// headless runs, not the canvas). Returns the number of LUTs made.
+size_t MapLuts(CompiledCircuit& circuit);
+
+// ================================
+// SUBCIRCUIT LIBRARY
+// ================================
+
+// Most definitions a library holds
+const int MAX_SUBCIRCUITS = 256;
+
+// Shared subcircuit definitions, addressed by id. A definition can only use
+// definitions added before it, so hierarchies never recurse. Definitions never
+// change once added and their storage never moves, so another thread (the
+// simulation thread) may evaluate while the editor adds more.
+class SubcircuitLibrary {
+private:
+    std::vector<std::unique_ptr<CompiledCircuit>> definitions;   // MAX_SUBCIRCUITS slots, filled in order
+    std::vector<CircuitDescription> descriptions;                // What each was compiled from, for saving
+    std::atomic<int> count{ 0 };
+
+    void EvaluateInto(const CompiledCircuit& circuit, std::vector<BusWord>& nets, size_t base) const;
+    void EvaluateFourValuedInto(const CompiledCircuit& circuit, std::vector<BusWord>& nets,
+        std::vector<BusWord>& unknown, size_t base) const;
+
+public:
+    SubcircuitLibrary();
+
+    // Compile and add a definition; returns its id, or -1 if the library is full or the
+    // description has clocked gates (instances keep no state between evaluations)
+    int Add(const CircuitDescription& description);
+
+    // Id of a definition compiled from an identical description (same name, nodes and
+    // edges), or -1. Loading a file reuses these rather than adding the block again.
+    int Find(const CircuitDescription& description) const;
+
+    const CompiledCircuit* Get(int id) const;
+    const CircuitDescription* GetDescription(int id) const;
+    int Count() const { return count.load(std::memory_order_acquire); }
+
+    // Evaluate one instance: inputs and outputs hold one word per port
+    void Evaluate(int id, const BusWord* inputs, BusWord* outputs) const;
+
+    // One clock cycle of a circuit kept outside the library (such as the whole canvas).
+    // nets must hold scratchNets words; input nets keep whatever the caller set.
+    // Combinational ops run once in dependency order; if there are clocked gates
+    // they then all load their next state at once and the ops run again, so every
+    // net reflects the new state when Step returns.
+    void Step(const CompiledCircuit& circuit, std::vector<BusWord>& nets) const;
+
+    // Step on four-valued signals (see LogicWord): unknown is the second bit-plane
+    // of nets, also scratchNets words. Unconnected inputs read Z; every other net
+    // starts wherever the caller left it (all known low for a fresh circuit).
+    // Runs the ops as compiled rather than as mapped to LUTs, so X spreads gate by gate.
+    void StepFourValued(const CompiledCircuit& circuit, std::vector<BusWord>& nets, std::vector<BusWord>& unknown) const;
+};
+
+// Definitions available to the editor
+extern SubcircuitLibrary SUBCIRCUITS;
+
+#endif // NETLIST_H
@@ -0,0 +1,88 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// ================================
+// OBJECT POOL TEMPLATE
+// ================================
+
+// Fixed-size blocks for one type, carved out of large chunks and recycled
+// through a free list. Chunks double in size up to MAX_CHUNK_OBJECTS, so a
+// million objects take a few dozen allocations instead of a million, and
+// freed blocks are reused before any new chunk is taken. Chunks are only
+// returned when the pool itself is destroyed.
+//
+// Not thread-safe: each pool belongs to the thread that creates and deletes
+// its objects (the UI thread for gates and wires).
+template <typename T>
+class ObjectPool {
+private:
+    union Block {
+        Block* next;                                      // While free
+        alignas(T) unsigned char storage[sizeof(T)];      // While in use
+    };
+
+    static const size_t FIRST_CHUNK_OBJECTS = 64;
+    static const size_t MAX_CHUNK_OBJECTS = 65536;
+
+    std::vector<Block*> chunks;
+    Block* freeList = nullptr;
+    size_t nextChunkObjects = FIRST_CHUNK_OBJECTS;
+    size_t freeObjects = 0;
+    size_t liveObjects = 0;
+
+    void AddChunk(size_t objects) {
+        Block* chunk = static_cast<Block*>(::operator new(objects * sizeof(Block)));
+        chunks.push_back(chunk);
+        // Thread the new blocks onto the free list so the lowest address is handed out first
+        for (size_t i = objects; i-- > 0;) {
+            chunk[i].next = freeList;
+            freeList = &chunk[i];
+        }
+        freeObjects += objects;
+    }
+
+public:
+    ObjectPool() {}
+    ~ObjectPool() {
+        for (Block* chunk : chunks) ::operator delete(chunk);
+    }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Raw storage for one T
+    void* Allocate() {
+        if (!freeList) {
+            AddChunk(nextChunkObjects);
+            if (nextChunkObjects < MAX_CHUNK_OBJECTS) nextChunkObjects *= 2;
+        }
+        Block* block = freeList;
+        freeList = block->next;
+        freeObjects--;
+        liveObjects++;
+        return block;
+    }
+
+    void Free(void* pointer) {
+        if (!pointer) return;
+        Block* block = static_cast<Block*>(pointer);
+        block->next = freeList;
+        freeList = block;
+        freeObjects++;
+        liveObjects--;
+    }
+
+    // Make sure count more objects fit without further chunk allocations
+    void Reserve(size_t count) {
+        if (freeObjects < count) AddChunk(count - freeObjects);
+    }
+
+    size_t LiveObjects() const { return liveObjects; }
+    size_t ChunkCount() const { return chunks.size(); }
+};
+
+#endif // OBJECT_POOL_H
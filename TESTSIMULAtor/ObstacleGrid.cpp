@@ -0,0 +1,123 @@
+#include "ObstacleGrid.h"
+#include "Constants.h"
+#include <algorithm>
+#include <cmath>
+
+// ================================
+// OBSTACLE GRID IMPLEMENTATION
+// ================================
+
+// Constructor
+ObstacleGrid::ObstacleGrid(std::vector<Rectangle> gateBounds) {
+    Build(std::move(gateBounds));
+}
+
+// Rebuild the grid from a fresh set of gate bounds
+void ObstacleGrid::Build(std::vector<Rectangle> gateBounds) {
+    bounds = std::move(gateBounds);
+    cellStart.clear();
+    cellItems.clear();
+    columns = rows = 0;
+
+    // Area covered by all gates (empty rectangles are free slots)
+    int gateCount = 0;
+    float minX = 0, minY = 0, maxX = 0, maxY = 0;
+    for (const Rectangle& rect : bounds) {
+        if (IsFreeSlot(rect)) continue;
+        if (gateCount++ == 0) {
+            minX = rect.x;
+            minY = rect.y;
+            maxX = rect.x + rect.width;
+            maxY = rect.y + rect.height;
+        }
+        minX = std::min(minX, rect.x);
+        minY = std::min(minY, rect.y);
+        maxX = std::max(maxX, rect.x + rect.width);
+        maxY = std::max(maxY, rect.y + rect.height);
+    }
+    if (gateCount == 0) {
+        bounds.clear();
+        return;
+    }
+    area = { minX, minY, maxX - minX, maxY - minY };
+
+    // Aim for roughly one gate per cell, but never finer than OBSTACLE_CELL_SIZE
+    float areaPerGate = (area.width * area.height) / (float)gateCount;
+    cellSize = std::max(OBSTACLE_CELL_SIZE, std::sqrt(areaPerGate));
+    columns = (int)(area.width / cellSize) + 1;
+    rows = (int)(area.height / cellSize) + 1;
+
+    // Count, prefix-sum, then fill
+    cellStart.assign((size_t)columns * rows + 1, 0);
+    for (const Rectangle& rect : bounds) {
+        if (IsFreeSlot(rect)) continue;
+        int c0, r0, c1, r1;
+        CellRange(rect, c0, r0, c1, r1);
+        for (int r = r0; r <= r1; r++) {
+            for (int c = c0; c <= c1; c++) {
+                cellStart[(size_t)r * columns + c + 1]++;
+            }
+        }
+    }
+    for (size_t i = 1; i < cellStart.size(); i++) {
+        cellStart[i] += cellStart[i - 1];
+    }
+
+    cellItems.resize(cellStart.back());
+    std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < (int)bounds.size(); i++) {
+        if (IsFreeSlot(bounds[i])) continue;
+        int c0, r0, c1, r1;
+        CellRange(bounds[i], c0, r0, c1, r1);
+        for (int r = r0; r <= r1; r++) {
+            for (int c = c0; c <= c1; c++) {
+                cellItems[fill[(size_t)r * columns + c]++] = i;
+            }
+        }
+    }
+}
+
+// Clamp a world rectangle to the cells it covers
+bool ObstacleGrid::CellRange(Rectangle rect, int& firstColumn, int& firstRow, int& lastColumn, int& lastRow) const {
+    if (rect.x > area.x + area.width || rect.y > area.y + area.height ||
+        rect.x + rect.width < area.x || rect.y + rect.height < area.y) {
+        return false;
+    }
+
+    firstColumn = std::max(0, (int)((rect.x - area.x) / cellSize));
+    firstRow = std::max(0, (int)((rect.y - area.y) / cellSize));
+    lastColumn = std::min(columns - 1, (int)((rect.x + rect.width - area.x) / cellSize));
+    lastRow = std::min(rows - 1, (int)((rect.y + rect.height - area.y) / cellSize));
+    return true;
+}
+
+// True if box overlaps any gate (grown by clearance) other than the two skipped ones
+bool ObstacleGrid::Intersects(Rectangle box, float clearance, int skipA, int skipB) const {
+    if (bounds.empty()) return false;
+
+    Rectangle query = { box.x - clearance, box.y - clearance, box.width + 2 * clearance, box.height + 2 * clearance };
+    int c0, r0, c1, r1;
+    if (!CellRange(query, c0, r0, c1, r1)) return false;
+
+    for (int r = r0; r <= r1; r++) {
+        for (int c = c0; c <= c1; c++) {
+            size_t cell = (size_t)r * columns + c;
+            for (int k = cellStart[cell]; k < cellStart[cell + 1]; k++) {
+                int i = cellItems[k];
+                if (i == skipA || i == skipB) continue;
+
+                const Rectangle& gateBounds = bounds[i];
+                Rectangle expandedBounds = {
+                    gateBounds.x - clearance,
+                    gateBounds.y - clearance,
+                    gateBounds.width + 2 * clearance,
+                    gateBounds.height + 2 * clearance
+                };
+                if (CheckCollisionRecs(box, expandedBounds)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,47 @@
+#ifndef OBSTACLE_GRID_H
+#define OBSTACLE_GRID_H
+
+#include "raylib.h"
+#include <vector>
+#include <cstddef>
+
+// ================================
+// OBSTACLE GRID DECLARATION
+// ================================
+
+// Read-only snapshot of gate bounds bucketed into a uniform grid, so a route
+// segment only tests the gates near it instead of every gate in the design.
+// Entry i of the snapshot is the gate in slot i of the GateStore at the time
+// it was taken; empty rectangles mark free slots and are ignored. Once built
+// it is never modified, so any number of routing threads may share it.
+class ObstacleGrid {
+private:
+    std::vector<Rectangle> bounds;
+    Rectangle area = { 0, 0, 0, 0 };
+    float cellSize = 0.0f;
+    int columns = 0;
+    int rows = 0;
+
+    // Gate indices per cell, stored compactly: cell c owns cellItems[cellStart[c] .. cellStart[c + 1])
+    std::vector<int> cellStart;
+    std::vector<int> cellItems;
+
+    static bool IsFreeSlot(Rectangle rect) { return rect.width <= 0 && rect.height <= 0; }
+
+    // Clamp a world rectangle to the cells it covers; false if it misses the grid
+    bool CellRange(Rectangle rect, int& firstColumn, int& firstRow, int& lastColumn, int& lastRow) const;
+
+public:
+    ObstacleGrid() = default;
+    explicit ObstacleGrid(std::vector<Rectangle> gateBounds);
+
+    // Rebuild the grid from a fresh set of gate bounds
+    void Build(std::vector<Rectangle> gateBounds);
+
+    bool Empty() const { return bounds.empty(); }
+
+    // True if box overlaps any gate (grown by clearance) other than the two skipped ones
+    bool Intersects(Rectangle box, float clearance, int skipA = -1, int skipB = -1) const;
+};
+
+#endif // OBSTACLE_GRID_H
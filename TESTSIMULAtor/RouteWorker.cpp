@@ -0,0 +1,110 @@
+#include "RouteWorker.h"
+#include "Constants.h"
+#include "Wire.h"
+
+// ================================
+// ROUTE WORKER IMPLEMENTATION
+// ================================
+
+// Constructor
+RouteWorker::RouteWorker() {
+    thread = std::thread(&RouteWorker::Run, this);
+}
+
+// Destructor - stop and join the worker thread
+RouteWorker::~RouteWorker() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        latestSequence++;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+// Queue a request, superseding any earlier one
+unsigned long long RouteWorker::Submit(std::vector<RouteJob> jobs, std::vector<Rectangle> gateBounds, bool immediate) {
+    unsigned long long sequence;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        sequence = ++latestSequence;
+        pending.sequence = sequence;
+        pending.jobs = std::move(jobs);
+        pending.gateBounds = std::move(gateBounds);
+        pending.immediate = immediate;
+        pending.submittedAt = std::chrono::steady_clock::now();
+        hasPending = true;
+    }
+    wake.notify_all();
+    return sequence;
+}
+
+// Drop the queued request and discard anything still in flight
+void RouteWorker::Cancel() {
+    std::lock_guard<std::mutex> lock(mutex);
+    latestSequence++;
+    hasPending = false;
+    hasPublished = false;
+}
+
+// Take the published result if it belongs to the newest request
+bool RouteWorker::TakeResult(RouteResult& result) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!hasPublished) return false;
+
+    hasPublished = false;
+    if (published.sequence != latestSequence.load()) return false;
+
+    result = std::move(published);
+    return true;
+}
+
+// Worker loop
+void RouteWorker::Run() {
+    const std::chrono::milliseconds debounce(ROUTE_DEBOUNCE_MS);
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        wake.wait(lock, [this] { return stopping || hasPending; });
+        if (stopping) return;
+
+        // Debounce: wait until the request has been quiet long enough
+        while (!stopping && hasPending && !pending.immediate &&
+            std::chrono::steady_clock::now() < pending.submittedAt + debounce) {
+            wake.wait_until(lock, pending.submittedAt + debounce);
+        }
+        if (stopping) return;
+        if (!hasPending) continue; // Cancelled while waiting
+
+        RouteRequest request = std::move(pending);
+        hasPending = false;
+        lock.unlock();
+
+        // Route every job against the snapshot, bailing out as soon as a newer request arrives
+        RouteResult result;
+        result.sequence = request.sequence;
+        result.routes.reserve(request.jobs.size());
+
+        ObstacleGrid obstacles(std::move(request.gateBounds));
+        bool cancelled = false;
+        for (const RouteJob& job : request.jobs) {
+            if (latestSequence.load() != request.sequence) {
+                cancelled = true;
+                break;
+            }
+
+            Wire route(job.fromGate, job.toGate, 0);
+            route.CalculateLRoute(job.start, job.end, obstacles);
+            result.routes.push_back(std::move(route.waypoints));
+        }
+
+        lock.lock();
+        if (!cancelled && latestSequence.load() == request.sequence) {
+            // Publish the whole batch at once
+            published = std::move(result);
+            hasPublished = true;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef ROUTE_WORKER_H
+#define ROUTE_WORKER_H
+
+#include "raylib.h"
+#include "SlotMap.h"
+#include "Constants.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+
+// ================================
+// ROUTE WORKER DECLARATION
+// ================================
+
+// One wire to route: endpoints plus the gates the route may touch
+struct RouteJob {
+    GateHandle fromGate;
+    GateHandle toGate;
+    Vector2 start;
+    Vector2 end;
+};
+
+// Finished routes for one request, in the same order as its jobs
+struct RouteResult {
+    unsigned long long sequence = 0;
+    std::vector<WaypointList> routes;
+};
+
+// Routes wires on a background thread against a snapshot of gate bounds.
+// Only the newest request is kept: submitting again replaces a request that
+// has not started and cancels one that is running. Results are published as a
+// whole and picked up by the UI thread with TakeResult.
+class RouteWorker {
+private:
+    struct RouteRequest {
+        unsigned long long sequence = 0;
+        std::vector<RouteJob> jobs;
+        std::vector<Rectangle> gateBounds;
+        bool immediate = false;
+        std::chrono::steady_clock::time_point submittedAt;
+    };
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    bool hasPending = false;
+    RouteRequest pending;
+
+    bool hasPublished = false;
+    RouteResult published;
+
+    // Sequence number of the newest request; anything older is stale
+    std::atomic<unsigned long long> latestSequence{ 0 };
+
+    void Run();
+
+public:
+    RouteWorker();
+    ~RouteWorker();
+
+    RouteWorker(const RouteWorker&) = delete;
+    RouteWorker& operator=(const RouteWorker&) = delete;
+
+    // Queue a request, superseding any earlier one. Non-immediate requests wait
+    // for ROUTE_DEBOUNCE_MS of quiet so a drag does not reroute every frame.
+    unsigned long long Submit(std::vector<RouteJob> jobs, std::vector<Rectangle> gateBounds, bool immediate);
+
+    // Drop the queued request and discard anything still in flight
+    void Cancel();
+
+    // Take the published result if it belongs to the newest request
+    bool TakeResult(RouteResult& result);
+};
+
+#endif // ROUTE_WORKER_H
@@ -0,0 +1,192 @@
+#include "SceneRenderer.h"
+#include <cmath>
+#include <algorithm>
+
+// ================================
+// SCENE RENDERER IMPLEMENTATION
+// ================================
+
+// Grow a rectangle to include another one
+static Rectangle UnionRect(Rectangle a, Rectangle b, bool aEmpty) {
+    if (aEmpty) return b;
+    float minX = std::min(a.x, b.x), minY = std::min(a.y, b.y);
+    float maxX = std::max(a.x + a.width, b.x + b.width);
+    float maxY = std::max(a.y + a.height, b.y + b.height);
+    return { minX, minY, maxX - minX, maxY - minY };
+}
+
+long long SceneRenderer::TileKey(Vector2 worldPos) {
+    long long column = (long long)std::floor(worldPos.x / RENDER_TILE_SIZE);
+    long long row = (long long)std::floor(worldPos.y / RENDER_TILE_SIZE);
+    return (row << 32) ^ (column & 0xffffffffLL);
+}
+
+// Bring tiles up to date with the gates and wiring
+bool SceneRenderer::Update(const GateStore& gates, const WiringSystem& wiring, GateHandle liveGate) {
+    bool liveGateChanged = !hasBuilt || liveGate != builtLiveGate;
+    bool statesChanged = !hasBuilt || wiring.GetStateRevision() != builtStateRevision;
+    bool routesChanged = !hasBuilt || wiring.GetRouteRevision() != builtRouteRevision;
+    bool layoutChanged = gatesDirty || routesChanged || liveGateChanged;
+
+    if (layoutChanged) {
+        Rebucket(gates, wiring, liveGate);
+    }
+    else if (statesChanged) {
+        // Same layout, new colours: rebuild lazily as tiles are drawn
+        for (auto& pair : tiles) {
+            pair.second->stale = true;
+        }
+    }
+
+    builtLiveGate = liveGate;
+    builtStateRevision = wiring.GetStateRevision();
+    builtRouteRevision = wiring.GetRouteRevision();
+    gatesDirty = false;
+    hasBuilt = true;
+    return layoutChanged;
+}
+
+// Draw the cached tiles overlapping view
+void SceneRenderer::DrawCached(const GateStore& gates, Rectangle view, DetailLevel detail) {
+    // Cull tiles and rebuild the visible ones that are out of date
+    visibleTiles.clear();
+    for (auto& pair : tiles) {
+        RenderTile& tile = *pair.second;
+        bool gatesVisible = !tile.gateIndices.empty() && CheckCollisionRecs(view, tile.gateBounds);
+        bool wiresVisible = !tile.wires.empty() && CheckCollisionRecs(view, tile.wireBounds);
+        if (!gatesVisible && !wiresVisible) continue;
+
+        if (tile.stale || tile.builtDetail != detail) {
+            RebuildTile(tile, gates, detail);
+        }
+        visibleTiles.push_back(&tile);
+    }
+
+    // Gates first, wires on top
+    for (RenderTile* tile : visibleTiles) {
+        tile->gateGeometry.Draw();
+    }
+    if (detail == DetailLevel::FULL) {
+        for (RenderTile* tile : visibleTiles) {
+            for (int index : tile->labelGates) {
+                gates[index]->DrawLabelText();
+            }
+        }
+    }
+    for (RenderTile* tile : visibleTiles) {
+        tile->wireGeometry.Draw();
+    }
+}
+
+// Draw the live gate with a highlight, plus its wires
+void SceneRenderer::DrawLive(const GateStore& gates) const {
+    const std::unique_ptr<Gate>* live = gates.Get(builtLiveGate);
+    if (!live) return;
+
+    (*live)->Draw(false, true);
+    for (const Wire* wire : liveWires) {
+        wire->Draw(WiringSystem::GetWireColor(*wire));
+    }
+}
+
+// Outline the selected gates that overlap view
+void SceneRenderer::DrawSelection(const GateStore& gates, const std::vector<GateHandle>& selected, Rectangle view,
+    float lineWidth) const {
+    for (GateHandle handle : selected) {
+        const std::unique_ptr<Gate>* gate = gates.Get(handle);
+        if (!gate) continue;
+        Rectangle bounds = (*gate)->GetBounds();
+        if (!CheckCollisionRecs(view, bounds)) continue;
+        Rectangle outline = { bounds.x - 2 * lineWidth, bounds.y - 2 * lineWidth,
+            bounds.width + 4 * lineWidth, bounds.height + 4 * lineWidth };
+        DrawRectangleLinesEx(outline, lineWidth, SELECTION_COLOR);
+    }
+}
+
+// Sort gates and wires into tiles (after structural changes)
+void SceneRenderer::Rebucket(const GateStore& gates, const WiringSystem& wiring, GateHandle liveGate) {
+    for (auto& pair : tiles) {
+        RenderTile& tile = *pair.second;
+        tile.gateIndices.clear();
+        tile.wires.clear();
+        tile.stale = true;
+    }
+    liveWires.clear();
+
+    auto tileAt = [this](Vector2 worldPos) -> RenderTile& {
+        std::unique_ptr<RenderTile>& slot = tiles[TileKey(worldPos)];
+        if (!slot) slot.reset(new RenderTile());
+        return *slot;
+    };
+
+    int liveIndex = gates.IndexOf(liveGate);
+    for (int i = 0; i < (int)gates.size(); i++) {
+        if (i == liveIndex) continue;
+        RenderTile& tile = tileAt(gates[i]->position);
+        tile.gateBounds = UnionRect(tile.gateBounds, gates[i]->GetBounds(), tile.gateIndices.empty());
+        tile.gateIndices.push_back(i);
+    }
+
+    for (const auto& wire : wiring.GetWires()) {
+        if (!gates.Contains(wire->fromGate) || !gates.Contains(wire->toGate)) continue;
+        if (wire->waypoints.empty()) continue;
+
+        if (wire->fromGate == liveGate || wire->toGate == liveGate) {
+            liveWires.push_back(wire.get());
+            continue;
+        }
+
+        RenderTile& tile = tileAt(wire->waypoints.front());
+        tile.wireBounds = UnionRect(tile.wireBounds, wire->GetBounds(), tile.wires.empty());
+        tile.wires.push_back(wire.get());
+    }
+
+    // Drop tiles that became empty
+    for (auto it = tiles.begin(); it != tiles.end();) {
+        if (it->second->gateIndices.empty() && it->second->wires.empty()) {
+            it = tiles.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+// Regenerate one tile's geometry
+void SceneRenderer::RebuildTile(RenderTile& tile, const GateStore& gates, DetailLevel detail) {
+    tile.gateGeometry.Begin(GATE_ATLAS);
+    tile.labelGates.clear();
+    for (int index : tile.gateIndices) {
+        if (detail == DetailLevel::SIMPLE) {
+            gates[index]->AppendSimplifiedGeometry(tile.gateGeometry);
+        }
+        else {
+            gates[index]->AppendGeometry(tile.gateGeometry);
+            if (gates[index]->NeedsLabelText()) {
+                tile.labelGates.push_back(index);
+            }
+        }
+    }
+    tile.gateGeometry.End();
+
+    tile.wireGeometry.Begin(GATE_ATLAS);
+    for (const Wire* wire : tile.wires) {
+        if (detail == DetailLevel::SIMPLE) {
+            wire->AppendSimplifiedGeometry(tile.wireGeometry, WiringSystem::GetWireColor(*wire));
+        }
+        else {
+            wire->AppendGeometry(tile.wireGeometry, WiringSystem::GetWireColor(*wire));
+        }
+    }
+    tile.wireGeometry.End();
+
+    tile.stale = false;
+    tile.builtDetail = detail;
+}
+
+// Release GPU buffers (before the window closes)
+void SceneRenderer::Unload() {
+    tiles.clear();
+    visibleTiles.clear();
+    hasBuilt = false;
+}
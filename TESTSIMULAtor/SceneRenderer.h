@@ -0,0 +1,81 @@
+#ifndef SCENE_RENDERER_H
+#define SCENE_RENDERER_H
+
+#include "raylib.h"
+#include "Gate.h"
+#include "Wire.h"
+#include "WiringSystem.h"
+#include "GeometryBuffer.h"
+#include "Viewport.h"
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+// ================================
+// SCENE RENDERER DECLARATION
+// ================================
+
+// Draws placed gates and wires from cached geometry buffers, split into
+// RENDER_TILE_SIZE world tiles. Each tile is culled against the view and only
+// rebuilt when it is visible and stale, so frame time follows what is on
+// screen rather than design size. Tiles go stale when the wiring system
+// reports new routes or signal states, when gates are marked dirty, or when
+// the level of detail changes. The gate being dragged and its wires are left
+// out of the cache and drawn directly by DrawLive.
+class SceneRenderer {
+private:
+    struct RenderTile {
+        std::vector<int> gateIndices;
+        std::vector<const Wire*> wires;
+        std::vector<int> labelGates;       // Gates without an image, labelled with text
+
+        // Bounds of the contents (wires may reach well outside the tile itself)
+        Rectangle gateBounds = { 0, 0, 0, 0 };
+        Rectangle wireBounds = { 0, 0, 0, 0 };
+
+        GeometryBuffer gateGeometry;
+        GeometryBuffer wireGeometry;
+        bool stale = true;
+        DetailLevel builtDetail = DetailLevel::FULL;
+    };
+
+    std::unordered_map<long long, std::unique_ptr<RenderTile>> tiles;
+    std::vector<RenderTile*> visibleTiles;
+    std::vector<const Wire*> liveWires;    // Wires attached to the live gate
+
+    bool gatesDirty = true;
+    bool hasBuilt = false;
+    unsigned long long builtRouteRevision = 0;
+    unsigned long long builtStateRevision = 0;
+    GateHandle builtLiveGate;
+
+    static long long TileKey(Vector2 worldPos);
+
+    // Sort gates and wires into tiles (after structural changes)
+    void Rebucket(const GateStore& gates, const WiringSystem& wiring, GateHandle liveGate);
+
+    // Regenerate one tile's geometry
+    void RebuildTile(RenderTile& tile, const GateStore& gates, DetailLevel detail);
+
+public:
+    // Gates were placed, moved or removed
+    void MarkGatesDirty() { gatesDirty = true; }
+
+    // Bring tiles up to date with the gates and wiring; liveGate (if valid) is kept out of the
+    // cache. Returns true if the layout changed, false if at most signal colours did.
+    bool Update(const GateStore& gates, const WiringSystem& wiring, GateHandle liveGate);
+
+    // Draw the cached tiles overlapping view
+    void DrawCached(const GateStore& gates, Rectangle view, DetailLevel detail);
+
+    // Draw the live gate with a highlight, plus its wires
+    void DrawLive(const GateStore& gates) const;
+
+    // Outline the selected gates that overlap view (lineWidth in world units)
+    void DrawSelection(const GateStore& gates, const std::vector<GateHandle>& selected, Rectangle view, float lineWidth) const;
+
+    // Release GPU buffers (before the window closes)
+    void Unload();
+};
+
+#endif // SCENE_RENDERER_H
@@ -0,0 +1,112 @@
+#include "Selection.h"
+#include "ObstacleGrid.h"
+#include <algorithm>
+
+// ================================
+// SELECTION AND CLIPBOARD IMPLEMENTATION
+// ================================
+
+// Gates overlapping area, in store order
+void SelectGatesInRect(const GateStore& gates, Rectangle area, std::vector<GateHandle>& selected) {
+    selected.clear();
+    for (size_t i = 0; i < gates.size(); i++) {
+        if (CheckCollisionRecs(area, gates[i]->GetBounds())) {
+            selected.push_back(gates.HandleAt(i));
+        }
+    }
+}
+
+// Drop selected gates that no longer exist
+void PruneSelection(const GateStore& gates, std::vector<GateHandle>& selected) {
+    selected.erase(std::remove_if(selected.begin(), selected.end(),
+        [&gates](GateHandle handle) { return !gates.Contains(handle); }), selected.end());
+}
+
+// Copy selected gates and the wires among them
+CircuitClip CopySelection(const GateStore& gates, const WiringSystem& wiring, const std::vector<GateHandle>& selected) {
+    CircuitClip clip;
+    if (selected.empty()) return clip;
+
+    clip.circuit = wiring.DescribeGates(gates, selected);
+    clip.circuit.name = "clip";
+
+    Rectangle first = (*gates.Get(selected[0]))->GetBounds();
+    float minX = first.x, minY = first.y, maxX = first.x + first.width, maxY = first.y + first.height;
+    for (GateHandle handle : selected) {
+        Rectangle bounds = (*gates.Get(handle))->GetBounds();
+        minX = std::min(minX, bounds.x);
+        minY = std::min(minY, bounds.y);
+        maxX = std::max(maxX, bounds.x + bounds.width);
+        maxY = std::max(maxY, bounds.y + bounds.height);
+    }
+    clip.corner = { minX, minY };
+    clip.size = { maxX - minX, maxY - minY };
+
+    clip.offsets.reserve(selected.size());
+    clip.sizes.reserve(selected.size());
+    clip.inputValues.reserve(selected.size());
+    for (GateHandle handle : selected) {
+        const Gate& gate = **gates.Get(handle);
+        clip.offsets.push_back({ gate.position.x - minX, gate.position.y - minY });
+        clip.sizes.push_back(gate.GetSize());
+        clip.inputValues.push_back(gate.GetType() == GateType::INPUT ? gate.input1 : 0);
+    }
+    return clip;
+}
+
+// Place copies of a clip in one batch
+bool PasteClip(const CircuitClip& clip, Vector2 origin, Vector2 step, int copies,
+    GateStore& gates, WiringSystem& wiring, std::vector<GateHandle>& placed) {
+    placed.clear();
+    if (clip.Empty() || copies <= 0) return false;
+
+    size_t nodeCount = clip.circuit.nodes.size();
+    size_t total = nodeCount * (size_t)copies;
+    auto copyBounds = [&](size_t item) {
+        size_t copy = item / nodeCount, node = item % nodeCount;
+        return Rectangle{ origin.x + step.x * copy + clip.offsets[node].x, origin.y + step.y * copy + clip.offsets[node].y,
+            clip.sizes[node].x, clip.sizes[node].y };
+    };
+
+    // One collision pass: the canvas and every copy share one grid, and each new gate
+    // is tested against whatever is near it (itself excepted)
+    std::vector<Rectangle> bounds = SnapshotGateBounds(gates);
+    size_t firstNew = bounds.size();
+    bounds.reserve(firstNew + total);
+    for (size_t item = 0; item < total; item++) {
+        bounds.push_back(copyBounds(item));
+    }
+    ObstacleGrid occupied(std::move(bounds));
+    for (size_t item = 0; item < total; item++) {
+        if (occupied.Intersects(copyBounds(item), 0.0f, (int)(firstNew + item))) return false;
+    }
+
+    // Size every store for the whole batch first
+    size_t wireCount = clip.circuit.edges.size() * (size_t)copies;
+    Gate::ReservePool(total);
+    gates.Reserve(gates.size() + total);
+    wiring.Reserve(wireCount, gates.SlotCount() + total);
+    placed.reserve(total);
+
+    std::vector<WireHandle> newWires;
+    newWires.reserve(wireCount);
+    wiring.BeginBulkConnect();
+    for (int copy = 0; copy < copies; copy++) {
+        size_t base = placed.size();
+        for (size_t n = 0; n < nodeCount; n++) {
+            const NetlistNode& node = clip.circuit.nodes[n];
+            Rectangle at = copyBounds(base + n);
+            auto gate = std::make_unique<Gate>(node.type, Vector2{ at.x, at.y }, node.definition, node.width);
+            if (node.type == GateType::INPUT) gate->input1 = clip.inputValues[n];
+            placed.push_back(gates.Insert(std::move(gate)));
+        }
+        for (const NetlistEdge& edge : clip.circuit.edges) {
+            WireHandle wire = wiring.Connect(gates, placed[base + edge.fromNode], edge.fromPort,
+                placed[base + edge.toNode], edge.toPort);
+            if (wire.IsValid()) newWires.push_back(wire);
+        }
+    }
+    wiring.EndBulkConnect();
+    wiring.RouteWires(gates, newWires);
+    return true;
+}
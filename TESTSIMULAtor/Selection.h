@@ -0,0 +1,46 @@
+#ifndef SELECTION_H
+#define SELECTION_H
+
+#include "raylib.h"
+#include "Constants.h"
+#include "Gate.h"
+#include "WiringSystem.h"
+#include <vector>
+
+// ================================
+// SELECTION AND CLIPBOARD
+// ================================
+
+// A piece of the canvas taken by Ctrl+C: its gates as netlist nodes, the wires
+// with both ends inside it, and where each gate sat relative to the piece's
+// top-left corner. Pasting rebuilds the piece anywhere, any number of times.
+struct CircuitClip {
+    CircuitDescription circuit;
+    std::vector<Vector2> offsets;       // Each node's position, from the top-left corner
+    std::vector<Vector2> sizes;         // Each node's gate size
+    std::vector<BusWord> inputValues;   // Values of INPUT nodes (0 for the rest)
+    Vector2 corner = { 0, 0 };          // Where the top-left corner was when copied
+    Vector2 size = { 0, 0 };            // Extent of all the gates
+
+    bool Empty() const { return circuit.nodes.empty(); }
+};
+
+// Gates overlapping area, in store order
+void SelectGatesInRect(const GateStore& gates, Rectangle area, std::vector<GateHandle>& selected);
+
+// Drop selected gates that no longer exist (undo can take them away)
+void PruneSelection(const GateStore& gates, std::vector<GateHandle>& selected);
+
+// Copy selected gates and the wires among them (selected must be pruned)
+CircuitClip CopySelection(const GateStore& gates, const WiringSystem& wiring, const std::vector<GateHandle>& selected);
+
+// Place copies of a clip in one batch, copy i with its top-left corner at
+// origin + step * i. Storage is reserved once up front, every copy is checked
+// for overlaps in one pass over an ObstacleGrid of the canvas, and the new
+// wires are routed together in one parallel pass. All or nothing: if any copy
+// would overlap a gate or another copy, nothing is placed and false is
+// returned. placed receives the new gates.
+bool PasteClip(const CircuitClip& clip, Vector2 origin, Vector2 step, int copies,
+    GateStore& gates, WiringSystem& wiring, std::vector<GateHandle>& placed);
+
+#endif // SELECTION_H
@@ -1,19 +1,65 @@
 #include "Sidebar.h"
+#include <algorithm>
+#include <string>
 
 // ================================
 // SIDEBAR CLASS IMPLEMENTATION
 // ================================
 
+// Subcircuit block buttons below the gate list, a scrolling window of BLOCK_SLOTS
+// with page buttons beside the heading
+static const int BLOCK_SLOTS = 5;
+static const float BLOCK_LIST_TOP = 630.0f;
+
+static Rectangle BlockButtonRect(int slot) {
+    return { 25, BLOCK_LIST_TOP + slot * 32.0f, 150, 26 };
+}
+
+static Rectangle BlockPageRect(bool down) {
+    return { down ? 176.0f : 154.0f, BLOCK_LIST_TOP - 24, 18, 18 };
+}
+
+// Gate buttons sit in two columns, with the CLEAR button under them
+static const float GATE_LIST_TOP = 120.0f;
+
+static Rectangle GateButtonRect(int i) {
+    return { 15 + (i % 2) * 95.0f, GATE_LIST_TOP + (i / 2) * 60.0f, 75, 50 };
+}
+
+static Rectangle DeselectButtonRect(int gateCount) {
+    return { 15, GATE_LIST_TOP + ((gateCount + 1) / 2) * 60.0f + 20, 170, 30 };
+}
+
 // Constructor
 Sidebar::Sidebar() {
     gateTypes = {
         GateType::INPUT, GateType::OUTPUT, GateType::AND,
-        GateType::OR, GateType::NOT, GateType::NAND, GateType::NOR
+        GateType::OR, GateType::NOT, GateType::NAND, GateType::NOR,
+        GateType::CLOCK, GateType::DFF, GateType::REGISTER
     };
 }
 
+void Sidebar::ClampBlockScroll() {
+    firstBlock = std::max(0, std::min(firstBlock, SUBCIRCUITS.Count() - BLOCK_SLOTS));
+}
+
+// Scroll the block list
+void Sidebar::Update(Vector2 mousePos, SimulatorMode mode) {
+    int count = SUBCIRCUITS.Count();
+    if (count > knownBlocks) {
+        firstBlock = count - BLOCK_SLOTS;
+        knownBlocks = count;
+    }
+
+    float wheel = GetMouseWheelMove();
+    if (wheel != 0.0f && mode == SimulatorMode::PLACEMENT && mousePos.x <= SIDEBAR_WIDTH) {
+        firstBlock += (wheel > 0) ? -1 : 1;
+    }
+    ClampBlockScroll();
+}
+
 // Render sidebar
-void Sidebar::Draw(bool hasSelection, GateType selectedType, SimulatorMode mode) {
+void Sidebar::Draw(bool hasSelection, GateType selectedType, SimulatorMode mode, int selectedDefinition) {
     // Draw sidebar background
     DrawRectangle(0, 0, SIDEBAR_WIDTH, SCREEN_HEIGHT, DARKGRAY);
 
@@ -26,9 +72,8 @@ void Sidebar::Draw(bool hasSelection, GateType selectedType, SimulatorMode mode)
 
     // Draw gate selection buttons (only in placement mode)
     if (mode == SimulatorMode::PLACEMENT) {
-        int y = 120;
         for (int i = 0; i < gateTypes.size(); i++) {
-            Rectangle buttonRect = { 40, (float)y, 75, 50 };
+            Rectangle buttonRect = GateButtonRect(i);
 
             // Get gate info for drawing
             const GateInfo& gateInfo = GATE_DATA.at(gateTypes[i]);
@@ -38,7 +83,7 @@ void Sidebar::Draw(bool hasSelection, GateType selectedType, SimulatorMode mode)
             if (gateInfo.texture.id != 0) {
                 // Don't draw background or border for textured gates to preserve transparency
                 // Scale image to fit inside button while preserving aspect ratio
-                Rectangle sourceRect = { 0, 0, (float)gateInfo.texture.width, (float)gateInfo.texture.height };
+                Rectangle sourceRect = gateInfo.atlasRect;
                 Rectangle destRect = {
                     buttonRect.x + 5,  // Add small margin
                     buttonRect.y + 5,
@@ -79,12 +124,10 @@ void Sidebar::Draw(bool hasSelection, GateType selectedType, SimulatorMode mode)
                 // Draw border for non-textured gates
                 DrawRectangleLinesEx(buttonRect, isSelected ? 3 : 2, isSelected ? YELLOW : BLACK);
             }
-
-            y += 60;
         }
 
         // Draw deselect button
-        Rectangle deselectRect = { 40, (float)y + 20, 75, 30 };
+        Rectangle deselectRect = DeselectButtonRect((int)gateTypes.size());
         DrawRectangleRec(deselectRect, GRAY);
         DrawRectangleLinesEx(deselectRect, 2, BLACK);
 
@@ -92,6 +135,37 @@ void Sidebar::Draw(bool hasSelection, GateType selectedType, SimulatorMode mode)
         int deselectTextWidth = MeasureText(deselectLabel, 12);
         DrawText(deselectLabel, deselectRect.x + (deselectRect.width - deselectTextWidth) / 2,
             deselectRect.y + 9, 12, WHITE);
+
+        // Draw subcircuit blocks
+        DrawText("BLOCKS (B = make)", 10, (int)BLOCK_LIST_TOP - 22, 14, RAYWHITE);
+        int count = SUBCIRCUITS.Count();
+        int last = std::min(count, firstBlock + BLOCK_SLOTS);
+        if (count > BLOCK_SLOTS) {
+            for (bool down : { false, true }) {
+                Rectangle pageRect = BlockPageRect(down);
+                bool usable = down ? last < count : firstBlock > 0;
+                DrawRectangleRec(pageRect, usable ? GRAY : DARKGRAY);
+                DrawRectangleLinesEx(pageRect, 1, BLACK);
+                float midX = pageRect.x + pageRect.width / 2, top = pageRect.y + 5, bottom = pageRect.y + pageRect.height - 5;
+                if (down) DrawTriangle({ midX - 5, top }, { midX, bottom }, { midX + 5, top }, RAYWHITE);
+                else DrawTriangle({ midX - 5, bottom }, { midX + 5, bottom }, { midX, top }, RAYWHITE);
+            }
+            std::string range = std::to_string(firstBlock + 1) + "-" + std::to_string(last) + " of " + std::to_string(count)
+                + " (wheel scrolls)";
+            DrawText(range.c_str(), 25, (int)BLOCK_LIST_TOP + BLOCK_SLOTS * 32, 10, LIGHTGRAY);
+        }
+        for (int id = firstBlock; id < last; id++) {
+            const CompiledCircuit* block = SUBCIRCUITS.Get(id);
+            Rectangle blockRect = BlockButtonRect(id - firstBlock);
+            bool isSelected = hasSelection && selectedType == GateType::SUBCIRCUIT && selectedDefinition == id;
+
+            DrawRectangleRec(blockRect, GATE_DATA.at(GateType::SUBCIRCUIT).color);
+            DrawRectangleLinesEx(blockRect, isSelected ? 3 : 2, isSelected ? YELLOW : BLACK);
+
+            std::string blockLabel = block->name + " (" + std::to_string(block->inputNets.size()) + "in/"
+                + std::to_string(block->outputNets.size()) + "out)";
+            DrawText(blockLabel.c_str(), (int)blockRect.x + 6, (int)blockRect.y + 7, 12, WHITE);
+        }
     }
     else {
         // In wiring mode, show instructions
@@ -116,9 +190,11 @@ void Sidebar::Draw(bool hasSelection, GateType selectedType, SimulatorMode mode)
 }
 
 // Handle button clicks
-GateType Sidebar::CheckButtonClick(Vector2 mousePos, bool& shouldDeselect, bool& shouldToggleMode, SimulatorMode mode) {
+GateType Sidebar::CheckButtonClick(Vector2 mousePos, bool& shouldDeselect, bool& shouldToggleMode, SimulatorMode mode,
+    int& clickedDefinition) {
     shouldDeselect = false;
     shouldToggleMode = false;
+    clickedDefinition = -1;
 
     if (mousePos.x > SIDEBAR_WIDTH) return (GateType)-1;
 
@@ -132,22 +208,35 @@ GateType Sidebar::CheckButtonClick(Vector2 mousePos, bool& shouldDeselect, bool&
     // Only handle gate buttons in placement mode
     if (mode != SimulatorMode::PLACEMENT) return (GateType)-1;
 
-    int y = 120;
     for (int i = 0; i < gateTypes.size(); i++) {
-        Rectangle buttonRect = { 40, (float)y, 75, 50 };
-
-        if (CheckCollisionPointRec(mousePos, buttonRect)) {
+        if (CheckCollisionPointRec(mousePos, GateButtonRect(i))) {
             return gateTypes[i];
         }
-
-        y += 60;
     }
 
     // Check deselect button
-    Rectangle deselectRect = { 40, (float)y + 20, 75, 30 };
+    Rectangle deselectRect = DeselectButtonRect((int)gateTypes.size());
     if (CheckCollisionPointRec(mousePos, deselectRect)) {
         shouldDeselect = true;
     }
 
+    // Page through the block list
+    for (bool down : { false, true }) {
+        if (SUBCIRCUITS.Count() > BLOCK_SLOTS && CheckCollisionPointRec(mousePos, BlockPageRect(down))) {
+            firstBlock += down ? BLOCK_SLOTS : -BLOCK_SLOTS;
+            ClampBlockScroll();
+            return (GateType)-1;
+        }
+    }
+
+    // Check subcircuit blocks
+    int last = std::min(SUBCIRCUITS.Count(), firstBlock + BLOCK_SLOTS);
+    for (int id = firstBlock; id < last; id++) {
+        if (CheckCollisionPointRec(mousePos, BlockButtonRect(id - firstBlock))) {
+            clickedDefinition = id;
+            return GateType::SUBCIRCUIT;
+        }
+    }
+
     return (GateType)-1;
 }
\ No newline at end of file
@@ -3,9 +3,17 @@
 
 #include "raylib.h"
 #include "Constants.h"
+#include "Netlist.h"
 #include <vector>
 
 class Sidebar {
+private:
+    int firstBlock = 0;         // Topmost subcircuit block shown in the block list
+    int knownBlocks = 0;        // Library size last update, to spot new blocks
+
+    // Keep firstBlock inside the list
+    void ClampBlockScroll();
+
 public:
     // Available gate types in sidebar
     std::vector<GateType> gateTypes;
@@ -13,11 +21,15 @@ public:
     // Constructor
     Sidebar();
 
-    // Render sidebar
-    void Draw(bool hasSelection, GateType selectedType, SimulatorMode mode);
+    // Scroll the block list with the mouse wheel over the sidebar; new blocks scroll into view
+    void Update(Vector2 mousePos, SimulatorMode mode);
+
+    // Render sidebar (selectedDefinition is the selected subcircuit, if any)
+    void Draw(bool hasSelection, GateType selectedType, SimulatorMode mode, int selectedDefinition = -1);
 
-    // Handle button clicks
-    GateType CheckButtonClick(Vector2 mousePos, bool& shouldDeselect, bool& shouldToggleMode, SimulatorMode mode);
+    // Handle button clicks; clicking a subcircuit block returns SUBCIRCUIT with its id in clickedDefinition
+    GateType CheckButtonClick(Vector2 mousePos, bool& shouldDeselect, bool& shouldToggleMode, SimulatorMode mode,
+        int& clickedDefinition);
 };
 
 #endif
\ No newline at end of file
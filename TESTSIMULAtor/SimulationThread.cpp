@@ -0,0 +1,291 @@
+#include "SimulationThread.h"
+#include <chrono>
+#include <algorithm>
+
+// ================================
+// SIMULATION THREAD IMPLEMENTATION
+// ================================
+
+// Commands the UI may have in flight before Push starts failing
+static const size_t COMMAND_QUEUE_CAPACITY = 1024;
+
+// Longest stretch of simulation between command checks and snapshot publishes
+static const std::chrono::microseconds SLICE(1000);
+
+// Constructor
+SimulationThread::SimulationThread(const SubcircuitLibrary& subcircuits, double ticksPerSecond)
+    : library(subcircuits), commands(COMMAND_QUEUE_CAPACITY) {
+    thread = std::thread(&SimulationThread::Run, this, ticksPerSecond);
+}
+
+// Destructor - stop and join the simulation thread
+SimulationThread::~SimulationThread() {
+    stopping = true;
+    Wake();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+// Rouse the thread if it sleeps; the flag keeps a wake sent just before it waits
+void SimulationThread::Wake() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakeRequested = true;
+    }
+    wake.notify_one();
+}
+
+// Queue a command, counting it so IsIdle can tell when it has been applied
+bool SimulationThread::Send(Command command) {
+    if (!commands.Push(std::move(command))) return false;
+    commandsSent++;
+    Wake();
+    return true;
+}
+
+// Ticks the thread has counted, but not published, since a settled snapshot
+static unsigned long long TicksSince(const SimulationSnapshot& snapshot, std::chrono::steady_clock::time_point now) {
+    if (!snapshot.settled || snapshot.tickPeriod == std::chrono::steady_clock::duration::zero() || now < snapshot.nextTick) {
+        return 0;
+    }
+    return (unsigned long long)((now - snapshot.nextTick) / snapshot.tickPeriod) + 1;
+}
+
+unsigned long long SimulationSnapshot::TickNow() const {
+    return tick + TicksSince(*this, std::chrono::steady_clock::now());
+}
+
+ToggleCoverage SimulationSnapshot::CoverageNow() const {
+    ToggleCoverage now = coverage;
+    if (now.NetCount() > 0) now.Repeat(nets.data(), TicksSince(*this, std::chrono::steady_clock::now()));
+    return now;
+}
+
+// Replace the circuit
+unsigned long long SimulationThread::Load(std::shared_ptr<const CompiledCircuit> circuit, std::vector<std::pair<int, BusWord>> netValues) {
+    Command command;
+    command.type = Command::Type::LOAD;
+    command.circuit = std::move(circuit);
+    command.version = loadedVersion + 1;
+    command.netValues = std::move(netValues);
+    if (!Send(std::move(command))) return 0;
+    return ++loadedVersion;
+}
+
+// Drive a net from now on
+bool SimulationThread::SetNet(int net, BusWord value) {
+    Command command;
+    command.type = Command::Type::SET_NET;
+    command.net = net;
+    command.value = value;
+    return Send(std::move(command));
+}
+
+bool SimulationThread::SetTickRate(double ticksPerSecond) {
+    Command command;
+    command.type = Command::Type::SET_RATE;
+    command.ticksPerSecond = ticksPerSecond;
+    return Send(std::move(command));
+}
+
+// Replace the state of a loaded circuit
+bool SimulationThread::Restore(unsigned long long version, std::vector<BusWord> nets, unsigned long long tick) {
+    Command command;
+    command.type = Command::Type::RESTORE;
+    command.version = version;
+    command.nets = std::move(nets);
+    command.tick = tick;
+    return Send(std::move(command));
+}
+
+bool SimulationThread::SetCoverage(bool enabled) {
+    Command command;
+    command.type = Command::Type::SET_COVERAGE;
+    command.enabled = enabled;
+    return Send(std::move(command));
+}
+
+bool SimulationThread::SetFourValued(bool enabled) {
+    Command command;
+    command.type = Command::Type::SET_FOUR_VALUED;
+    command.enabled = enabled;
+    return Send(std::move(command));
+}
+
+// Simulation loop
+void SimulationThread::Run(double ticksPerSecond) {
+    typedef std::chrono::steady_clock Clock;
+
+    std::shared_ptr<const CompiledCircuit> circuit;
+    std::vector<BusWord> nets;
+    unsigned long long version = 0;
+    unsigned long long tick = 0;
+
+    ToggleCoverage coverage;
+    bool coverageOn = false;
+    std::vector<BusWord> unknown;
+    bool fourValued = false;
+
+    // Fixed-point check: the first tick of each slice is compared with the nets before it
+    std::vector<BusWord> probe, probeUnknown;
+    bool probing = false;
+    bool settled = false;
+    unsigned long long commandsApplied = 0;
+
+    auto step = [&]() {
+        if (probing) {
+            probe.assign(nets.begin(), nets.begin() + circuit->netCount);
+            if (fourValued) probeUnknown.assign(unknown.begin(), unknown.begin() + circuit->netCount);
+        }
+        if (fourValued) library.StepFourValued(*circuit, nets, unknown);
+        else library.Step(*circuit, nets);
+        if (probing) {
+            settled = std::equal(probe.begin(), probe.end(), nets.begin()) &&
+                (!fourValued || std::equal(probeUnknown.begin(), probeUnknown.end(), unknown.begin()));
+            probing = false;
+        }
+        if (coverageOn) coverage.Sample(nets.data());
+    };
+
+    Clock::duration period = Clock::duration::zero();
+    auto setRate = [&period](double rate) {
+        period = (rate > 0) ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate))
+                            : Clock::duration::zero();
+    };
+    setRate(ticksPerSecond);
+    Clock::time_point nextTick = Clock::now();
+
+    // Measured rate, over windows of a quarter second
+    Clock::time_point windowStart = Clock::now();
+    unsigned long long windowTicks = 0;
+    double measuredRate = 0;
+
+    while (!stopping.load(std::memory_order_relaxed)) {
+        bool changed = false;
+
+        // Settled at a fixed rate: count the ticks slept through (they'd have left the
+        // nets as they are) before any command changes things
+        if (circuit && settled && period != Clock::duration::zero()) {
+            Clock::time_point now = Clock::now();
+            if (nextTick <= now) {
+                unsigned long long due = (unsigned long long)((now - nextTick) / period) + 1;
+                tick += due;
+                nextTick += period * (Clock::duration::rep)due;
+                if (coverageOn) coverage.Repeat(nets.data(), due);
+            }
+        }
+
+        Command command;
+        while (commands.Pop(command)) {
+            switch (command.type) {
+            case Command::Type::LOAD:
+                circuit = std::move(command.circuit);
+                version = command.version;
+                tick = 0;
+                nets.assign(circuit ? circuit->scratchNets : 0, 0);
+                for (const auto& netValue : command.netValues) {
+                    if (netValue.first > 0 && netValue.first < (int)nets.size()) nets[netValue.first] = netValue.second;
+                }
+                unknown.assign(nets.size(), 0);
+                coverage.Reset(circuit ? circuit->netCount : 0);
+                nextTick = Clock::now();
+                break;
+            case Command::Type::SET_NET:
+                if (circuit && command.net > 0 && command.net < circuit->netCount) nets[command.net] = command.value;
+                break;
+            case Command::Type::SET_RATE:
+                setRate(command.ticksPerSecond);
+                nextTick = Clock::now();
+                break;
+            case Command::Type::RESTORE:
+                if (circuit && command.version == version && (int)command.nets.size() >= circuit->netCount) {
+                    nets.swap(command.nets);
+                    nets.resize(circuit->scratchNets, 0);
+                    tick = command.tick;
+                    unknown.assign(nets.size(), 0);
+                    coverage.Reset(circuit->netCount);
+                    nextTick = Clock::now();
+                }
+                break;
+            case Command::Type::SET_COVERAGE:
+                coverageOn = command.enabled;
+                coverage.Reset(circuit ? circuit->netCount : 0);
+                break;
+            case Command::Type::SET_FOUR_VALUED:
+                fourValued = command.enabled;
+                unknown.assign(nets.size(), 0);
+                break;
+            }
+            commandsApplied++;
+            settled = false;
+            changed = true;
+        }
+
+        // Simulate for up to one slice: every due tick at a fixed rate, or flat out
+        Clock::time_point now = Clock::now();
+        Clock::time_point sliceEnd = now + SLICE;
+        unsigned long long ticksBefore = tick;
+        if (!circuit || settled) {
+            // Nothing to run until a command arrives (with no circuit, nothing ever changes)
+            settled = true;
+        }
+        else if (period == Clock::duration::zero()) {
+            probing = true;
+            do {
+                for (int i = 0; i < 64; i++) {
+                    step();
+                }
+                tick += 64;
+                now = Clock::now();
+            } while (now < sliceEnd);
+        }
+        else {
+            probing = true;
+            while (nextTick <= now && now < sliceEnd) {
+                step();
+                tick++;
+                nextTick += period;
+                if ((tick & 63) == 0) now = Clock::now();
+            }
+            // Fell far behind (rate too high for the circuit): don't try to catch up
+            if (now - nextTick > std::chrono::milliseconds(100)) nextTick = now;
+        }
+        changed = changed || tick != ticksBefore;
+
+        windowTicks += tick - ticksBefore;
+        if (now - windowStart >= std::chrono::milliseconds(250)) {
+            measuredRate = windowTicks / std::chrono::duration<double>(now - windowStart).count();
+            windowStart = now;
+            windowTicks = 0;
+        }
+
+        if (changed) {
+            int netCount = circuit ? circuit->netCount : 0;
+            SimulationSnapshot& snapshot = snapshots.Back();
+            snapshot.version = version;
+            snapshot.tick = tick;
+            snapshot.ticksPerSecond = measuredRate;
+            snapshot.settled = settled;
+            snapshot.commandsApplied = commandsApplied;
+            snapshot.nextTick = nextTick;
+            snapshot.tickPeriod = (circuit && settled) ? period : Clock::duration::zero();
+            snapshot.nets.assign(nets.begin(), nets.begin() + netCount);
+            if (fourValued) snapshot.unknown.assign(unknown.begin(), unknown.begin() + netCount);
+            else snapshot.unknown.clear();
+            if (coverageOn) snapshot.coverage = coverage;
+            else snapshot.coverage.Reset(0);
+            snapshots.Publish();
+        }
+
+        // Sleep until the next tick is due or a command arrives; with nothing to run,
+        // only a command wakes the thread
+        if (!circuit || settled || period != Clock::duration::zero()) {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            auto woken = [this]() { return wakeRequested; };
+            if (!circuit || settled) wake.wait(lock, woken);
+            else wake.wait_until(lock, nextTick, woken);
+            wakeRequested = false;
+        }
+    }
+}
@@ -0,0 +1,130 @@
+#ifndef SIMULATION_THREAD_H
+#define SIMULATION_THREAD_H
+
+#include "Netlist.h"
+#include "LockFree.h"
+#include "Coverage.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <utility>
+
+// ================================
+// SIMULATION THREAD DECLARATION
+// ================================
+
+// Net values published by the simulation thread
+struct SimulationSnapshot {
+    unsigned long long version = 0;     // Load these nets belong to (0 = nothing loaded)
+    unsigned long long tick = 0;        // Ticks simulated since that load
+    double ticksPerSecond = 0;          // Measured rate
+    bool settled = false;               // A tick changes no net, so nothing happens until the next command
+    unsigned long long commandsApplied = 0;     // Commands taken from the UI so far
+    std::vector<BusWord> nets;          // Value of every net of the loaded circuit
+    std::vector<BusWord> unknown;       // Four-valued mode only: the unknown plane of nets (see LogicWord)
+
+    // Toggle counts since the load (or since coverage was switched on); no nets while off
+    ToggleCoverage coverage;
+
+    // Settled at a fixed rate: the thread publishes nothing more and counts the ticks
+    // from the clock instead, due one period apart from nextTick (period zero otherwise)
+    std::chrono::steady_clock::time_point nextTick;
+    std::chrono::steady_clock::duration tickPeriod = std::chrono::steady_clock::duration::zero();
+
+    // Tick and coverage as of now, counting the ticks since a settled snapshot
+    unsigned long long TickNow() const;
+    ToggleCoverage CoverageNow() const;
+};
+
+// Runs a compiled circuit on its own thread, one full pass per tick, either at
+// a fixed tick rate or as fast as it can. The UI talks to it only through a
+// single-producer command queue and reads results from a triple-buffered
+// snapshot, so neither side ever waits on the other; a condition variable
+// only wakes the thread when it sleeps.
+//
+// Once a slice, one tick is checked for changing any net. If none changed the
+// circuit has settled and every later tick would be the same, so the thread
+// publishes one last snapshot and blocks until a command arrives. At a fixed
+// rate the ticks it skips are worked out from the clock (see TickNow) and
+// counted when it wakes.
+class SimulationThread {
+private:
+    struct Command {
+        enum class Type { LOAD, SET_NET, SET_RATE, RESTORE, SET_COVERAGE, SET_FOUR_VALUED };
+
+        Type type = Type::SET_NET;
+        std::shared_ptr<const CompiledCircuit> circuit;       // LOAD
+        unsigned long long version = 0;                       // LOAD, RESTORE
+        std::vector<std::pair<int, BusWord>> netValues;       // LOAD: starting values
+        std::vector<BusWord> nets;                            // RESTORE: every net
+        unsigned long long tick = 0;                          // RESTORE
+        int net = 0;                                          // SET_NET
+        BusWord value = 0;                                    // SET_NET
+        double ticksPerSecond = 0;                            // SET_RATE
+        bool enabled = false;                                 // SET_COVERAGE, SET_FOUR_VALUED
+    };
+
+    const SubcircuitLibrary& library;
+    SpscQueue<Command> commands;
+    TripleBuffer<SimulationSnapshot> snapshots;
+    std::atomic<bool> stopping{ false };
+    std::thread thread;
+
+    // Wakes the thread from its sleep between ticks or while settled
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    bool wakeRequested = false;     // Guarded by wakeMutex
+
+    void Wake();
+
+    unsigned long long loadedVersion = 0;   // UI side: newest version handed to Load
+    unsigned long long commandsSent = 0;    // UI side: commands queued so far
+
+    bool Send(Command command);
+    void Run(double ticksPerSecond);
+
+public:
+    // ticksPerSecond <= 0 runs as fast as possible
+    SimulationThread(const SubcircuitLibrary& library, double ticksPerSecond);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // UI side. Each returns false (Load returns 0) if the queue is full; try again next frame.
+
+    // Replace the circuit; netValues seed nets (typically the INPUT nets). Returns the
+    // version its snapshots will carry.
+    unsigned long long Load(std::shared_ptr<const CompiledCircuit> circuit, std::vector<std::pair<int, BusWord>> netValues);
+
+    // Drive a net (an INPUT's output net) from now on
+    bool SetNet(int net, BusWord value);
+
+    bool SetTickRate(double ticksPerSecond);
+
+    // Replace every net and the tick count of the circuit loaded as version (say from
+    // a checkpoint of Latest()); ignored if another circuit has been loaded since
+    bool Restore(unsigned long long version, std::vector<BusWord> nets, unsigned long long tick);
+
+    // Count net toggles every tick (see ToggleCoverage) and publish them with the snapshots.
+    // Switching on, loading and restoring start the counts from zero.
+    bool SetCoverage(bool enabled);
+
+    // Simulate on four-valued signals (see StepFourValued) and publish the unknown plane
+    // with the snapshots. Switching, loading and restoring make every net known again.
+    bool SetFourValued(bool enabled);
+
+    // Take the newest snapshot if one arrived since the last call, then read it with Latest
+    bool Refresh() { return snapshots.Refresh(); }
+    const SimulationSnapshot& Latest() const { return snapshots.Front(); }
+
+    // True if the latest snapshot has settled and reflects every command sent, so
+    // nothing will change until the UI sends another
+    bool IsIdle() const { return Latest().settled && Latest().commandsApplied == commandsSent; }
+};
+
+#endif // SIMULATION_THREAD_H
@@ -0,0 +1,174 @@
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#include <vector>
+#include <cstddef>
+
+// ================================
+// GENERATIONAL HANDLES
+// ================================
+
+// Stable reference to an item in a SlotMap. The slot index never changes while
+// the item lives; the generation is bumped when the slot is freed, so a handle
+// to a deleted item stops resolving instead of pointing at whatever reuses it.
+template <typename Tag>
+struct SlotHandle {
+    static const unsigned int INVALID_INDEX = 0xFFFFFFFFu;
+
+    unsigned int index = INVALID_INDEX;
+    unsigned int generation = 0;
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+
+    bool operator==(const SlotHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+struct GateHandleTag;
+struct WireHandleTag;
+typedef SlotHandle<GateHandleTag> GateHandle;
+typedef SlotHandle<WireHandleTag> WireHandle;
+
+// ================================
+// SLOT MAP TEMPLATE
+// ================================
+
+// Items live in one dense array, so iterating (and indexing with [] from 0 to
+// size()) is as fast as a plain vector. Insert and Erase are O(1): erasing
+// moves the last item into the hole, which changes that item's dense index but
+// not its handle. Dense indices are therefore only valid until the next Erase;
+// anything kept across frames should hold a handle. Restore puts an erased
+// item back under its old handle, which is how undo revives deleted items.
+template <typename T, typename Handle>
+class SlotMap {
+private:
+    struct Slot {
+        unsigned int denseIndex = Handle::INVALID_INDEX;
+        unsigned int generation = 1;
+        unsigned int highestGeneration = 1;   // Never reissued, even after a Restore
+    };
+
+    std::vector<T> items;
+    std::vector<unsigned int> itemSlots;     // Dense index -> slot index
+    std::vector<Slot> slots;
+    std::vector<unsigned int> freeSlots;     // May hold restored slots; Insert skips them
+
+public:
+    typedef typename std::vector<T>::iterator iterator;
+    typedef typename std::vector<T>::const_iterator const_iterator;
+
+    // Add an item and return its handle
+    Handle Insert(T item) {
+        unsigned int slotIndex = Handle::INVALID_INDEX;
+        while (!freeSlots.empty() && slotIndex == Handle::INVALID_INDEX) {
+            unsigned int candidate = freeSlots.back();
+            freeSlots.pop_back();
+            if (slots[candidate].denseIndex == Handle::INVALID_INDEX) slotIndex = candidate;
+        }
+        if (slotIndex == Handle::INVALID_INDEX) {
+            slotIndex = (unsigned int)slots.size();
+            slots.push_back(Slot());
+        }
+
+        slots[slotIndex].denseIndex = (unsigned int)items.size();
+        items.push_back(std::move(item));
+        itemSlots.push_back(slotIndex);
+
+        Handle handle;
+        handle.index = slotIndex;
+        handle.generation = slots[slotIndex].generation;
+        return handle;
+    }
+
+    // Remove an item; false if the handle is stale
+    bool Erase(Handle handle) {
+        if (!Contains(handle)) return false;
+
+        unsigned int dense = slots[handle.index].denseIndex;
+        unsigned int last = (unsigned int)items.size() - 1;
+        if (dense != last) {
+            items[dense] = std::move(items[last]);
+            itemSlots[dense] = itemSlots[last];
+            slots[itemSlots[dense]].denseIndex = dense;
+        }
+        items.pop_back();
+        itemSlots.pop_back();
+
+        slots[handle.index].denseIndex = Handle::INVALID_INDEX;
+        slots[handle.index].generation = ++slots[handle.index].highestGeneration;
+        freeSlots.push_back(handle.index);
+        return true;
+    }
+
+    // Put an item back into the slot it was erased from, under the same handle.
+    // False if the slot is occupied. Later Inserts still get fresh generations.
+    bool Restore(Handle handle, T item) {
+        if (handle.index >= slots.size()) return false;
+        Slot& slot = slots[handle.index];
+        if (slot.denseIndex != Handle::INVALID_INDEX || handle.generation > slot.highestGeneration) return false;
+
+        slot.generation = handle.generation;
+        slot.denseIndex = (unsigned int)items.size();
+        items.push_back(std::move(item));
+        itemSlots.push_back(handle.index);
+        return true;
+    }
+
+    void Clear() {
+        for (unsigned int slotIndex : itemSlots) {
+            slots[slotIndex].denseIndex = Handle::INVALID_INDEX;
+            slots[slotIndex].generation = ++slots[slotIndex].highestGeneration;
+            freeSlots.push_back(slotIndex);
+        }
+        items.clear();
+        itemSlots.clear();
+    }
+
+    void Reserve(size_t count) {
+        items.reserve(count);
+        itemSlots.reserve(count);
+        slots.reserve(count);
+    }
+
+    bool Contains(Handle handle) const {
+        return handle.index < slots.size() &&
+            slots[handle.index].generation == handle.generation &&
+            slots[handle.index].denseIndex != Handle::INVALID_INDEX;
+    }
+
+    // Resolve a handle (nullptr if stale)
+    T* Get(Handle handle) { return Contains(handle) ? &items[slots[handle.index].denseIndex] : nullptr; }
+    const T* Get(Handle handle) const { return Contains(handle) ? &items[slots[handle.index].denseIndex] : nullptr; }
+
+    // Item living in a slot, whatever its generation (nullptr if the slot is free)
+    const T* AtSlot(size_t slotIndex) const {
+        if (slotIndex >= slots.size() || slots[slotIndex].denseIndex == Handle::INVALID_INDEX) return nullptr;
+        return &items[slots[slotIndex].denseIndex];
+    }
+
+    // Current dense index of an item, or -1 if the handle is stale
+    int IndexOf(Handle handle) const { return Contains(handle) ? (int)slots[handle.index].denseIndex : -1; }
+
+    // Handle of the item at a dense index
+    Handle HandleAt(size_t denseIndex) const {
+        Handle handle;
+        handle.index = itemSlots[denseIndex];
+        handle.generation = slots[handle.index].generation;
+        return handle;
+    }
+
+    // Number of slots ever allocated; slot indices are always below this
+    size_t SlotCount() const { return slots.size(); }
+
+    // Dense access
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+    T& operator[](size_t denseIndex) { return items[denseIndex]; }
+    const T& operator[](size_t denseIndex) const { return items[denseIndex]; }
+    iterator begin() { return items.begin(); }
+    iterator end() { return items.end(); }
+    const_iterator begin() const { return items.begin(); }
+    const_iterator end() const { return items.end(); }
+};
+
+#endif // SLOT_MAP_H
@@ -0,0 +1,112 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// ================================
+// SMALL VECTOR TEMPLATE
+// ================================
+
+// Vector that keeps up to N items inside itself and only touches the heap when
+// it grows past that. Meant for the many short lists the editor keeps per
+// object (a wire's route, the wires on a gate), so clearing and refilling them
+// every frame costs no allocations. Items must be trivially copyable; they are
+// moved around with memcpy.
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable<T>::value, "SmallVector items are copied bytewise");
+
+private:
+    T* items;
+    size_t count = 0;
+    size_t capacity = N;
+    T inlineItems[N];
+
+    bool OnHeap() const { return items != inlineItems; }
+
+    void Grow(size_t wanted) {
+        size_t newCapacity = capacity * 2;
+        if (newCapacity < wanted) newCapacity = wanted;
+        T* grown = (T*)std::malloc(newCapacity * sizeof(T));
+        if (!grown) throw std::bad_alloc();
+        std::memcpy(grown, items, count * sizeof(T));
+        if (OnHeap()) std::free(items);
+        items = grown;
+        capacity = newCapacity;
+    }
+
+    void Release() {
+        if (OnHeap()) std::free(items);
+        items = inlineItems;
+        capacity = N;
+        count = 0;
+    }
+
+public:
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    SmallVector() : items(inlineItems) {}
+    SmallVector(const SmallVector& other) : items(inlineItems) { *this = other; }
+    SmallVector(SmallVector&& other) : items(inlineItems) { *this = std::move(other); }
+    ~SmallVector() { Release(); }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this == &other) return *this;
+        count = 0;
+        if (other.count > capacity) Grow(other.count);
+        std::memcpy(items, other.items, other.count * sizeof(T));
+        count = other.count;
+        return *this;
+    }
+
+    // Steals a heap buffer; inline items are copied
+    SmallVector& operator=(SmallVector&& other) {
+        if (this == &other) return *this;
+        if (!other.OnHeap()) return *this = (const SmallVector&)other;
+        Release();
+        items = other.items;
+        count = other.count;
+        capacity = other.capacity;
+        other.items = other.inlineItems;
+        other.count = 0;
+        other.capacity = N;
+        return *this;
+    }
+
+    void push_back(const T& item) {
+        if (count == capacity) {
+            T copy = item;   // item may live in this vector
+            Grow(count + 1);
+            items[count++] = copy;
+            return;
+        }
+        items[count++] = item;
+    }
+    void pop_back() { count--; }
+    void clear() { count = 0; }   // Keeps any heap buffer for reuse
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    T* data() { return items; }
+    const T* data() const { return items; }
+
+    T& operator[](size_t index) { return items[index]; }
+    const T& operator[](size_t index) const { return items[index]; }
+    T& front() { return items[0]; }
+    const T& front() const { return items[0]; }
+    T& back() { return items[count - 1]; }
+    const T& back() const { return items[count - 1]; }
+
+    iterator begin() { return items; }
+    iterator end() { return items + count; }
+    const_iterator begin() const { return items; }
+    const_iterator end() const { return items + count; }
+};
+
+#endif // SMALL_VECTOR_H
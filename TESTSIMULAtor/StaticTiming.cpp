@@ -0,0 +1,268 @@
+#include "StaticTiming.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+// ================================
+// STATIC TIMING IMPLEMENTATION
+// ================================
+
+// Arrival of nodes with no bound (on or fed by a combinational loop)
+static const float UNBOUNDED = std::numeric_limits<float>::infinity();
+
+// Times one Update may re-evaluate a node before it is taken to be going round
+// a loop that an edit just closed; the whole graph is then re-timed instead
+static const int LOOP_VISIT_LIMIT = 64;
+
+// Seeds beyond this (plus a quarter of the edges) are cheaper to re-time from scratch
+static const size_t MAX_SEEDS = 1024;
+
+// Drop one occurrence of value from a fanin or fanout list
+template <typename List>
+static void RemoveOne(List& list, int value) {
+    for (size_t i = 0; i < list.size(); i++) {
+        if (list[i] == value) {
+            list[i] = list.back();
+            list.pop_back();
+            return;
+        }
+    }
+}
+
+StaticTiming::Node& StaticTiming::At(int node) {
+    if ((size_t)node >= nodes.size()) nodes.resize(node + 1);
+    return nodes[node];
+}
+
+void StaticTiming::Seed(int node) {
+    if (stale) return;
+    seeds.push_back(node);
+    if (seeds.size() > MAX_SEEDS + edgeCount / 4) {
+        stale = true;
+        seeds.clear();
+    }
+}
+
+// Add an edge; a node seen for the first time (or again after losing all its edges) needs describing
+void StaticTiming::AddEdge(int from, int to) {
+    At(std::max(from, to));
+    Node& source = nodes[from];
+    Node& target = nodes[to];
+    if (!source.described && source.fanin.empty() && source.fanout.empty()) undescribed.push_back(from);
+    if (!target.described && target.fanin.empty() && target.fanout.empty()) undescribed.push_back(to);
+
+    source.fanout.push_back(to);
+    target.fanin.push_back(from);
+    edgeCount++;
+    Seed(to);
+}
+
+void StaticTiming::RemoveEdge(int from, int to) {
+    if ((size_t)std::max(from, to) >= nodes.size()) return;
+    Node& source = nodes[from];
+    Node& target = nodes[to];
+    RemoveOne(source.fanout, to);
+    RemoveOne(target.fanin, from);
+    edgeCount--;
+
+    // A slot left without edges may be reused by a gate of another kind
+    if (source.fanin.empty() && source.fanout.empty()) source.described = false;
+    if (target.fanin.empty() && target.fanout.empty()) target.described = false;
+    Seed(to);
+}
+
+void StaticTiming::Clear() {
+    nodes.clear();
+    endpoints.clear();
+    seeds.clear();
+    undescribed.clear();
+    edgeCount = 0;
+    stale = true;
+}
+
+void StaticTiming::Reserve(size_t nodeCount) {
+    nodes.reserve(nodeCount);
+    undescribed.reserve(nodeCount);
+}
+
+void StaticTiming::SetNode(int node, float delay, bool clocked, bool endpoint) {
+    Node& n = At(node);
+    n.described = true;
+    if (n.delay == delay && n.clocked == clocked && n.endpoint == endpoint) return;
+
+    Unrank(node);
+    n.delay = delay;
+    n.clocked = clocked;
+    n.endpoint = endpoint;
+    Seed(node);   // Evaluate ranks it again
+}
+
+void StaticTiming::Unrank(int node) {
+    Node& n = nodes[node];
+    if (!n.ranked) return;
+    endpoints.erase(std::make_pair(n.inputArrival, node));
+    n.ranked = false;
+}
+
+void StaticTiming::Rank(int node) {
+    Node& n = nodes[node];
+    if (n.ranked || !n.endpoint || n.fanin.empty() || std::isinf(n.inputArrival)) return;
+    endpoints.insert(std::make_pair(n.inputArrival, node));
+    n.ranked = true;
+}
+
+// Re-time one node from its drivers
+bool StaticTiming::Evaluate(int node) {
+    Node& n = nodes[node];
+    float latest = 0;
+    for (size_t i = 0; i < n.fanin.size(); i++) {
+        latest = std::max(latest, nodes[n.fanin[i]].arrival);
+    }
+    float arrival = n.clocked ? n.delay : latest + n.delay;
+
+    if (latest != n.inputArrival || (n.ranked != (n.endpoint && !n.fanin.empty() && !std::isinf(latest)))) {
+        Unrank(node);
+        n.inputArrival = latest;
+        Rank(node);
+    }
+    if (arrival == n.arrival) return false;
+    n.arrival = arrival;
+    return true;
+}
+
+// Bring arrival times up to date: re-time the seeds and follow changes downstream
+void StaticTiming::Update(const std::vector<int>* order) {
+    undescribed.clear();
+    if (stale) {
+        Rebuild();
+        return;
+    }
+
+    lastWork = 0;
+    visits.resize(nodes.size(), 0);
+    queued.resize(nodes.size(), 0);
+    worklist.clear();
+    for (int node : seeds) {
+        if ((size_t)node < nodes.size() && !queued[node]) {
+            queued[node] = 1;
+            worklist.push_back(node);
+        }
+    }
+    seeds.clear();
+
+    // With an order, take queued nodes earliest first; otherwise first come, first served
+    auto rank = [order](int node) {
+        return (order && (size_t)node < order->size()) ? (*order)[node] : node;
+    };
+    heap.clear();
+    if (order) {
+        for (int node : worklist) heap.push_back(std::make_pair(rank(node), node));
+        std::make_heap(heap.begin(), heap.end(), std::greater<std::pair<int, int>>());
+    }
+
+    bool looping = false;
+    for (size_t head = 0; order ? !heap.empty() : head < worklist.size(); head++) {
+        int node;
+        if (order) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<std::pair<int, int>>());
+            node = heap.back().second;
+            heap.pop_back();
+        }
+        else {
+            node = worklist[head];
+        }
+        queued[node] = 0;
+        lastWork++;
+        if (++visits[node] > LOOP_VISIT_LIMIT) {
+            looping = true;
+            break;
+        }
+        if (!Evaluate(node)) continue;
+        const Node& n = nodes[node];
+        for (size_t i = 0; i < n.fanout.size(); i++) {
+            int next = n.fanout[i];
+            if (!queued[next]) {
+                queued[next] = 1;
+                worklist.push_back(next);
+                if (order) {
+                    heap.push_back(std::make_pair(rank(next), next));
+                    std::push_heap(heap.begin(), heap.end(), std::greater<std::pair<int, int>>());
+                }
+            }
+        }
+    }
+    for (int node : worklist) {
+        visits[node] = 0;
+        queued[node] = 0;
+    }
+    if (looping) Rebuild();
+}
+
+// Re-time everything in topological order (Kahn); what is left over is on or behind a loop
+void StaticTiming::Rebuild() {
+    stale = false;
+    seeds.clear();
+    endpoints.clear();
+    lastWork = nodes.size();
+
+    // Clocked gates launch paths without waiting on their drivers, so their arrivals come first
+    std::vector<int> pending(nodes.size(), 0);
+    for (Node& n : nodes) {
+        n.ranked = false;
+        if (n.clocked) n.arrival = n.delay;
+        for (size_t i = 0; i < n.fanout.size(); i++) {
+            if (!n.clocked) pending[n.fanout[i]]++;
+        }
+    }
+
+    worklist.clear();
+    for (size_t node = 0; node < nodes.size(); node++) {
+        if (pending[node] == 0) worklist.push_back((int)node);
+    }
+    for (size_t head = 0; head < worklist.size(); head++) {
+        Node& n = nodes[worklist[head]];
+        float latest = 0;
+        for (size_t i = 0; i < n.fanin.size(); i++) {
+            latest = std::max(latest, nodes[n.fanin[i]].arrival);
+        }
+        n.inputArrival = latest;
+        n.arrival = n.clocked ? n.delay : latest + n.delay;
+        if (n.clocked) continue;
+        for (size_t i = 0; i < n.fanout.size(); i++) {
+            if (--pending[n.fanout[i]] == 0) worklist.push_back(n.fanout[i]);
+        }
+    }
+    for (size_t node = 0; node < nodes.size(); node++) {
+        Node& n = nodes[node];
+        if (pending[node] > 0) {
+            n.inputArrival = UNBOUNDED;
+            n.arrival = n.clocked ? n.delay : UNBOUNDED;
+        }
+        Rank((int)node);
+    }
+}
+
+float StaticTiming::CriticalDelay() const {
+    return endpoints.empty() ? -1.0f : endpoints.rbegin()->first;
+}
+
+// Walk back from the worst endpoint through the latest driver at each step
+void StaticTiming::CriticalPath(std::vector<int>& path) const {
+    path.clear();
+    if (endpoints.empty()) return;
+
+    int node = endpoints.rbegin()->second;
+    path.push_back(node);
+    while (path.size() <= nodes.size()) {
+        const Node& n = nodes[node];
+        if (n.fanin.empty()) break;
+        int latest = n.fanin[0];
+        for (size_t i = 1; i < n.fanin.size(); i++) {
+            if (nodes[n.fanin[i]].arrival > nodes[latest].arrival) latest = n.fanin[i];
+        }
+        path.push_back(latest);
+        if (nodes[latest].clocked) break;   // A path starts at a clocked gate
+        node = latest;
+    }
+}
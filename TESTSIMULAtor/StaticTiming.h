@@ -0,0 +1,91 @@
+#ifndef STATIC_TIMING_H
+#define STATIC_TIMING_H
+
+#include "SmallVector.h"
+#include <set>
+#include <utility>
+#include <vector>
+
+// ================================
+// STATIC TIMING (no raylib dependency)
+// ================================
+
+// Longest-path arrival times over the gate graph, kept up to date as wires
+// come and go. Nodes are gate slots; edges are wires from driver to consumer.
+//
+// A node's arrival is its delay plus the latest arrival among its drivers.
+// Clocked nodes launch a new path (their arrival is just their clock-to-output
+// delay), so loops through them are fine. Endpoints (OUTPUT and clocked gates)
+// are ranked by the arrival at their inputs, and the worst one ends the
+// critical path. Nodes on or fed by a combinational loop have no bound and
+// arrive at infinity; they never make the critical path.
+//
+// Wire edits only touch the adjacency and note where to start; Update then
+// re-evaluates the fanout cones of those nodes and stops wherever an arrival
+// comes out unchanged, so an edit costs the size of the cone it disturbs, not
+// the size of the design.
+class StaticTiming {
+private:
+    struct Node {
+        float delay = 0;
+        bool clocked = false;
+        bool endpoint = false;
+        bool described = false;     // Kind set since the node last gained an edge
+        bool ranked = false;        // Listed in endpoints under its inputArrival
+        float inputArrival = 0;     // Latest driver arrival
+        float arrival = 0;          // When the output settles
+        SmallVector<int, 2> fanin;
+        SmallVector<int, 4> fanout;
+    };
+    std::vector<Node> nodes;
+    size_t edgeCount = 0;
+
+    // Ranked endpoints (input arrival, node) with a finite arrival and at least one driver
+    std::set<std::pair<float, int>> endpoints;
+
+    // Nodes to re-evaluate on the next Update, and nodes waiting on SetNode
+    std::vector<int> seeds;
+    std::vector<int> undescribed;
+    bool stale = true;              // Seeds were dropped; Update re-times everything
+
+    // Update scratch, kept to avoid allocating per edit
+    std::vector<int> worklist;
+    std::vector<std::pair<int, int>> heap;     // (position, node), earliest first
+    std::vector<int> visits;
+    std::vector<char> queued;
+    size_t lastWork = 0;
+
+    Node& At(int node);
+    void Seed(int node);
+    void Unrank(int node);
+    void Rank(int node);
+    bool Evaluate(int node);        // True if its arrival changed
+    void Rebuild();
+
+public:
+    // Edits; nodes are gate slots and may be added in any order
+    void AddEdge(int from, int to);
+    void RemoveEdge(int from, int to);
+    void Clear();
+    void Reserve(size_t nodeCount);     // Room for nodes below nodeCount, ahead of a bulk load
+
+    // Nodes that gained an edge since last described; set each with SetNode before Update
+    const std::vector<int>& UndescribedNodes() const { return undescribed; }
+    void SetNode(int node, float delay, bool clocked, bool endpoint);
+
+    // Bring arrival times up to date with the edits so far. Given each node's
+    // position in a topological order (see DynamicTopology), nodes are re-timed
+    // in that order, so each is evaluated once after all of its drivers.
+    void Update(const std::vector<int>* order = nullptr);
+
+    // Delay of the critical path, or a negative value if there is no timed endpoint
+    float CriticalDelay() const;
+
+    // Nodes along the critical path, from its endpoint back to where it starts
+    void CriticalPath(std::vector<int>& path) const;
+
+    // Nodes re-evaluated by the last Update
+    size_t LastUpdateWork() const { return lastWork; }
+};
+
+#endif // STATIC_TIMING_H
@@ -1,90 +1,50 @@
 ﻿#include "Constants.h"
+#include "GateAtlasData.h"
 #include <iostream>
-#include <vector>
-#include <string>
 
-// Load textures for all gates
+static const int ATLAS_DIGIT_FONT_SIZE = 24;
+
+// Load the embedded gate atlas: one decode, one upload, no file access
 void LoadGateTextures() {
-    std::cout << "\n===== TEXTURE LOADING DIAGNOSTIC =====\n";
-    std::cout << "Current working directory: " << GetWorkingDirectory() << std::endl;
-    
-    // Try multiple potential resource paths
-    std::vector<std::string> possiblePaths = {
-        "",                // Current directory
-        "resources/",      // Resources subfolder
-        "../resources/",   // Parent directory's resources folder
-        "../../resources/", // Grandparent directory's resources folder
-        "./resources/"     // Explicit current directory
-    };
-    
-    // GATE_DATA is now properly mutable - no const_cast needed
-    bool anyTextureLoaded = false;
-    
+    Image atlas = LoadImageFromMemory(".png", GATE_ATLAS_PNG, GATE_ATLAS_PNG_SIZE);
+
+    // The state digits come from raylib's default font, so they are rendered into
+    // the slots reserved for them before the atlas goes to the GPU
+    const char* digits[2] = { "0", "1" };
+    for (int i = 0; i < 2; i++) {
+        Image glyph = ImageText(digits[i], ATLAS_DIGIT_FONT_SIZE, WHITE);
+        Rectangle& slot = ATLAS_DIGIT_RECTS[i];
+        if (glyph.width < slot.width) slot.width = (float)glyph.width;
+        if (glyph.height < slot.height) slot.height = (float)glyph.height;
+        ImageDraw(&atlas, glyph, { 0, 0, slot.width, slot.height }, slot, WHITE);
+        UnloadImage(glyph);
+    }
+
+    GATE_ATLAS = LoadTextureFromImage(atlas);
+    SetTextureFilter(GATE_ATLAS, TEXTURE_FILTER_BILINEAR);
+    UnloadImage(atlas);
+
+    if (GATE_ATLAS.id == 0) {
+        std::cout << "ERROR: Could not upload the gate atlas, gates will be drawn as labels" << std::endl;
+        return;
+    }
+
+    // Every gate with an image draws from the same texture
     for (auto& pair : GATE_DATA) {
-        GateInfo& info = pair.second;
-        
-        if (info.imagePath == nullptr) {
-            std::cout << "- No image path for " << info.label << " (this is expected for INPUT/OUTPUT)" << std::endl;
-            continue;
+        if (pair.second.atlasRect.width > 0) {
+            pair.second.texture = GATE_ATLAS;
         }
-        
-        bool textureLoaded = false;
-        const char* filename = info.imagePath;
-        
-        // Extract just the filename part (remove "resources/" if present)
-        const char* actualFilename = filename;
-        if (strstr(filename, "/") != nullptr) {
-            actualFilename = strrchr(filename, '/') + 1;
-        }
-        
-        // Try each possible path
-        for (const auto& basePath : possiblePaths) {
-            std::string fullPath = basePath + actualFilename;
-            
-            if (FileExists(fullPath.c_str())) {
-                info.texture = LoadTexture(fullPath.c_str());
-                
-                if (info.texture.id != 0) {
-                    // Apply texture smoothing/filtering
-                    SetTextureFilter(info.texture, TEXTURE_FILTER_BILINEAR);
-                    
-                    std::cout << "✓ Successfully loaded " << info.label << " texture from: " << fullPath << std::endl;
-                    std::cout << "  ID: " << info.texture.id << ", Size: " 
-                             << info.texture.width << "x" << info.texture.height << " (Smoothed)" << std::endl;
-                    textureLoaded = true;
-                    anyTextureLoaded = true;
-                    break;
-                } else {
-                    std::cout << "⚠ Found but failed to load: " << fullPath << std::endl;
-                }
-            } else {
-                std::cout << "- Tried path: " << fullPath << " (file not found)" << std::endl;
-            }
-        }
-        
-        if (!textureLoaded) {
-            std::cout << "✗ ERROR: Could not load texture for " << info.label << std::endl;
-        }
-    }
-    
-    if (!anyTextureLoaded) {
-        std::cout << "\n⚠ CRITICAL: No textures were loaded! Please check:\n";
-        std::cout << "  1. Image files exist in a 'resources' directory\n";
-        std::cout << "  2. Images are in PNG format\n";
-        std::cout << "  3. Images have appropriate read permissions\n";
-        std::cout << "  4. Try placing images in the same directory as the executable\n";
     }
-    
-    std::cout << "======================================\n\n";
 }
 
 // Unload all gate textures
 void UnloadGateTextures() {
     for (auto& pair : GATE_DATA) {
-        if (pair.second.texture.id != 0) {
-            std::cout << "Unloading texture: " << pair.second.label << " (ID: " << pair.second.texture.id << ")" << std::endl;
-            UnloadTexture(pair.second.texture);
-            pair.second.texture.id = 0;
-        }
+        pair.second.texture = { 0 };
+    }
+
+    if (GATE_ATLAS.id != 0) {
+        UnloadTexture(GATE_ATLAS);
+        GATE_ATLAS = { 0 };
     }
 }
\ No newline at end of file
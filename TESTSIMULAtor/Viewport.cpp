@@ -0,0 +1,91 @@
+#include "Viewport.h"
+#include "Constants.h"
+#include "raymath.h"
+
+// ================================
+// VIEWPORT CLASS IMPLEMENTATION
+// ================================
+
+// Constructor - world and screen coordinates start out identical
+Viewport::Viewport() {
+    camera.offset = { 0, 0 };
+    camera.target = { 0, 0 };
+    camera.rotation = 0.0f;
+    camera.zoom = 1.0f;
+}
+
+// Handle pan and zoom input
+bool Viewport::Update(Vector2 mousePos) {
+    bool overCanvas = mousePos.x > SIDEBAR_WIDTH;
+
+    // Pan with middle mouse, or Space + left mouse
+    bool panButtonDown = IsMouseButtonDown(MOUSE_MIDDLE_BUTTON) ||
+        (IsKeyDown(KEY_SPACE) && IsMouseButtonDown(MOUSE_LEFT_BUTTON));
+    if (!panning && panButtonDown && overCanvas) panning = true;
+    if (panning && !panButtonDown) panning = false;
+
+    if (panning) {
+        Vector2 delta = GetMouseDelta();
+        camera.target = Vector2Subtract(camera.target, Vector2Scale(delta, 1.0f / camera.zoom));
+    }
+
+    // Zoom around the cursor
+    float wheel = GetMouseWheelMove();
+    if (wheel != 0.0f && overCanvas) {
+        Vector2 worldUnderMouse = GetScreenToWorld2D(mousePos, camera);
+        camera.offset = mousePos;
+        camera.target = worldUnderMouse;
+
+        float scale = (wheel > 0) ? CAMERA_ZOOM_STEP : 1.0f / CAMERA_ZOOM_STEP;
+        camera.zoom = Clamp(camera.zoom * scale, CAMERA_MIN_ZOOM, CAMERA_MAX_ZOOM);
+    }
+
+    // Reset view
+    if (IsKeyPressed(KEY_HOME)) {
+        camera.offset = { 0, 0 };
+        camera.target = { 0, 0 };
+        camera.zoom = 1.0f;
+    }
+
+    return panning;
+}
+
+// Coordinate conversion
+Vector2 Viewport::ScreenToWorld(Vector2 screenPos) const {
+    return GetScreenToWorld2D(screenPos, camera);
+}
+
+Vector2 Viewport::WorldToScreen(Vector2 worldPos) const {
+    return GetWorldToScreen2D(worldPos, camera);
+}
+
+// Part of the world currently visible in the canvas area
+Rectangle Viewport::GetVisibleWorldRect() const {
+    Vector2 topLeft = ScreenToWorld({ (float)SIDEBAR_WIDTH, 0 });
+    Vector2 bottomRight = ScreenToWorld({ (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT });
+    return { topLeft.x, topLeft.y, bottomRight.x - topLeft.x, bottomRight.y - topLeft.y };
+}
+
+// Centre the canvas on a world area, zoomed to fit
+void Viewport::Frame(Rectangle world) {
+    float canvasWidth = (float)(SCREEN_WIDTH - SIDEBAR_WIDTH), canvasHeight = (float)SCREEN_HEIGHT;
+    float fit = fminf(canvasWidth / fmaxf(world.width, 1.0f), canvasHeight / fmaxf(world.height, 1.0f)) * 0.9f;
+    camera.zoom = Clamp(fit, CAMERA_MIN_ZOOM, CAMERA_MAX_ZOOM);
+    camera.offset = { SIDEBAR_WIDTH + canvasWidth / 2, canvasHeight / 2 };
+    camera.target = { world.x + world.width / 2, world.y + world.height / 2 };
+}
+
+DetailLevel Viewport::GetDetailLevel() const {
+    return (camera.zoom < LOD_SIMPLE_ZOOM) ? DetailLevel::SIMPLE : DetailLevel::FULL;
+}
+
+// Wrap world-space drawing (clipped to the canvas area)
+void Viewport::BeginWorld() const {
+    BeginScissorMode(SIDEBAR_WIDTH, 0, SCREEN_WIDTH - SIDEBAR_WIDTH, SCREEN_HEIGHT);
+    BeginMode2D(camera);
+}
+
+void Viewport::EndWorld() const {
+    EndMode2D();
+    EndScissorMode();
+}
@@ -0,0 +1,49 @@
+#ifndef VIEWPORT_H
+#define VIEWPORT_H
+
+#include "raylib.h"
+
+// ================================
+// VIEWPORT CLASS DECLARATION
+// ================================
+
+// Level of detail used when drawing the canvas
+enum class DetailLevel {
+    FULL,    // Textures, pins, labels and wire joints
+    SIMPLE   // Plain rectangles and lines when zoomed far out
+};
+
+// Camera2D over an unbounded canvas to the right of the sidebar.
+// Middle mouse drag (or Space + left drag) pans, the mouse wheel zooms
+// around the cursor, Home resets the view.
+class Viewport {
+private:
+    Camera2D camera;
+    bool panning = false;
+
+public:
+    Viewport();
+
+    // Handle pan and zoom input; returns true while the view is being panned
+    bool Update(Vector2 mousePos);
+
+    // Coordinate conversion
+    Vector2 ScreenToWorld(Vector2 screenPos) const;
+    Vector2 WorldToScreen(Vector2 worldPos) const;
+
+    // Part of the world currently visible in the canvas area
+    Rectangle GetVisibleWorldRect() const;
+
+    // Centre the canvas on a world area, zoomed to fit it (as far as the zoom limits allow)
+    void Frame(Rectangle world);
+
+    float GetZoom() const { return camera.zoom; }
+    DetailLevel GetDetailLevel() const;
+    const Camera2D& GetCamera() const { return camera; }
+
+    // Wrap world-space drawing (clipped to the canvas area)
+    void BeginWorld() const;
+    void EndWorld() const;
+};
+
+#endif // VIEWPORT_H
@@ -1,8 +1,37 @@
 #include "Wire.h"
 #include "Gate.h"
+#include "ObjectPool.h"
 #include <algorithm>
 #include <cmath>
 
+// Pooled allocation; anything of another size (a derived class) uses the heap
+static ObjectPool<Wire>& WirePool() {
+    static ObjectPool<Wire> pool;
+    return pool;
+}
+
+void* Wire::operator new(size_t size) {
+    return size == sizeof(Wire) ? WirePool().Allocate() : ::operator new(size);
+}
+
+void Wire::operator delete(void* pointer, size_t size) {
+    if (size == sizeof(Wire)) WirePool().Free(pointer);
+    else ::operator delete(pointer);
+}
+
+void Wire::ReservePool(size_t count) {
+    WirePool().Reserve(count);
+}
+
+// Calculate L-shaped route against the live gates
+void Wire::CalculateLRoute(Vector2 start, Vector2 end, const GateStore* gates) {
+    std::vector<Rectangle> gateBounds;
+    if (gates) {
+        gateBounds = SnapshotGateBounds(*gates);
+    }
+    CalculateLRoute(start, end, ObstacleGrid(std::move(gateBounds)));
+}
+
 // Draw the wire with L-routing
 void Wire::Draw(Color wireColor) const {
     if (waypoints.size() < 2) return;
@@ -10,7 +39,7 @@ void Wire::Draw(Color wireColor) const {
     // Draw smooth line segments between waypoints
     for (size_t i = 0; i < waypoints.size() - 1; i++) {
         // Use thicker lines with rounded caps for smoother appearance
-        DrawLineEx(waypoints[i], waypoints[i + 1], 4.0f, wireColor);
+        DrawLineEx(waypoints[i], waypoints[i + 1], GetThickness(), wireColor);
     }
 
     // Draw smooth connection points with gradient effect
@@ -31,6 +60,34 @@ void Wire::Draw(Color wireColor) const {
     }
 }
 
+// Batched rendering: emit the same picture as Draw() into a geometry buffer
+void Wire::AppendGeometry(GeometryBuffer& buffer, Color wireColor) const {
+    if (waypoints.size() < 2) return;
+
+    for (size_t i = 0; i < waypoints.size() - 1; i++) {
+        buffer.AddLine(waypoints[i], waypoints[i + 1], GetThickness(), wireColor);
+    }
+
+    Color endColor = ColorBrightness(wireColor, 0.3f);
+    buffer.AddDisc(waypoints.front(), 4, wireColor);
+    buffer.AddDisc(waypoints.front(), 3, endColor);
+    buffer.AddDisc(waypoints.back(), 4, wireColor);
+    buffer.AddDisc(waypoints.back(), 3, endColor);
+
+    Color cornerColor = ColorBrightness(wireColor, 0.2f);
+    for (size_t i = 1; i < waypoints.size() - 1; i++) {
+        buffer.AddDisc(waypoints[i], 3, wireColor);
+        buffer.AddDisc(waypoints[i], 2, cornerColor);
+    }
+}
+
+// Zoomed-out level of detail: segments only, no joints
+void Wire::AppendSimplifiedGeometry(GeometryBuffer& buffer, Color wireColor) const {
+    for (size_t i = 0; i + 1 < waypoints.size(); i++) {
+        buffer.AddLine(waypoints[i], waypoints[i + 1], GetThickness(), wireColor);
+    }
+}
+
 // Simple L-routing without gate avoidance
 void Wire::CalculateSimpleLRoute(Vector2 start, Vector2 end) {
     float dx = end.x - start.x;
@@ -68,40 +125,40 @@ float Wire::DistanceToLineSegment(Vector2 point, Vector2 lineStart, Vector2 line
 }
 
 // Simple but effective gate avoidance
-Vector2 Wire::CalculateAvoidanceRoute(Vector2 start, Vector2 end, const std::vector<std::unique_ptr<Gate>>& gates, float clearance) const {
+Vector2 Wire::CalculateAvoidanceRoute(Vector2 start, Vector2 end, const ObstacleGrid& obstacles, float clearance) const {
     float dx = end.x - start.x;
     float dy = end.y - start.y;
 
     // Try horizontal-first routing with different percentages
-    std::vector<float> percentages = { 0.5f, 0.7f, 0.3f, 0.8f, 0.2f };
+    static const float percentages[] = { 0.5f, 0.7f, 0.3f, 0.8f, 0.2f };
 
     for (float pct : percentages) {
         Vector2 horizontalRoute = { start.x + dx * pct, start.y };
-        if (!DoesRouteIntersectGates(start, horizontalRoute, { horizontalRoute.x, end.y }, end, gates, clearance)) {
+        if (!DoesRouteIntersectGates(start, horizontalRoute, { horizontalRoute.x, end.y }, end, obstacles, clearance)) {
             return horizontalRoute;
         }
 
         // Try vertical-first routing with same percentage
         Vector2 verticalRoute = { start.x, start.y + dy * pct };
-        if (!DoesRouteIntersectGates(start, verticalRoute, { end.x, verticalRoute.y }, end, gates, clearance)) {
+        if (!DoesRouteIntersectGates(start, verticalRoute, { end.x, verticalRoute.y }, end, obstacles, clearance)) {
             return verticalRoute;
         }
     }
 
     // Try going around obstacles with offsets
-    std::vector<float> offsets = { 60.0f, 120.0f, 180.0f, -60.0f, -120.0f, -180.0f };
+    static const float offsets[] = { 60.0f, 120.0f, 180.0f, -60.0f, -120.0f, -180.0f };
 
     for (float offset : offsets) {
         for (float pct : percentages) {
             // Try horizontal-first with vertical offset
             Vector2 candidate = { start.x + dx * pct, start.y + offset };
-            if (!DoesRouteIntersectGates(start, candidate, { candidate.x, end.y }, end, gates, clearance)) {
+            if (!DoesRouteIntersectGates(start, candidate, { candidate.x, end.y }, end, obstacles, clearance)) {
                 return candidate;
             }
 
             // Try vertical-first with horizontal offset
             candidate = { start.x + offset, start.y + dy * pct };
-            if (!DoesRouteIntersectGates(start, candidate, { end.x, candidate.y }, end, gates, clearance)) {
+            if (!DoesRouteIntersectGates(start, candidate, { end.x, candidate.y }, end, obstacles, clearance)) {
                 return candidate;
             }
         }
@@ -112,45 +169,31 @@ Vector2 Wire::CalculateAvoidanceRoute(Vector2 start, Vector2 end, const std::vec
 
 // Check if the L-route intersects with any gates
 bool Wire::DoesRouteIntersectGates(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4,
-    const std::vector<std::unique_ptr<Gate>>& gates, float clearance) const {
+    const ObstacleGrid& obstacles, float clearance) const {
     // Check each segment of the route
-    return DoesLineIntersectGates(p1, p2, gates, clearance) ||
-        DoesLineIntersectGates(p2, p3, gates, clearance) ||
-        DoesLineIntersectGates(p3, p4, gates, clearance);
+    return DoesLineIntersectGates(p1, p2, obstacles, clearance) ||
+        DoesLineIntersectGates(p2, p3, obstacles, clearance) ||
+        DoesLineIntersectGates(p3, p4, obstacles, clearance);
 }
 
 // Check if a line segment intersects with any gates  
-bool Wire::DoesLineIntersectGates(Vector2 start, Vector2 end, const std::vector<std::unique_ptr<Gate>>& gates, float clearance) const {
-    for (int i = 0; i < gates.size(); i++) {
-        // Skip the source and destination gates
-        if (i == fromGateIndex || i == toGateIndex) continue;
-
-        Rectangle gateBounds = gates[i]->GetBounds();
-        // Expand bounds by clearance
-        Rectangle expandedBounds = {
-            gateBounds.x - clearance,
-            gateBounds.y - clearance,
-            gateBounds.width + 2 * clearance,
-            gateBounds.height + 2 * clearance
-        };
-
-        // Create a proper bounding rectangle for the line segment
-        Rectangle lineBounds = {
-            std::min(start.x, end.x),
-            std::min(start.y, end.y),
-            std::abs(end.x - start.x) + 1.0f,  // Add small buffer for vertical/horizontal lines
-            std::abs(end.y - start.y) + 1.0f   // Add small buffer for vertical/horizontal lines
-        };
-
-        if (CheckCollisionRecs(lineBounds, expandedBounds)) {
-            return true;
-        }
-    }
-    return false;
+bool Wire::DoesLineIntersectGates(Vector2 start, Vector2 end, const ObstacleGrid& obstacles, float clearance) const {
+    // Create a proper bounding rectangle for the line segment
+    Rectangle lineBounds = {
+        std::min(start.x, end.x),
+        std::min(start.y, end.y),
+        std::abs(end.x - start.x) + 1.0f,  // Add small buffer for vertical/horizontal lines
+        std::abs(end.y - start.y) + 1.0f   // Add small buffer for vertical/horizontal lines
+    };
+
+    // Skip the source and destination gates
+    int skipFrom = fromGate.IsValid() ? (int)fromGate.index : -1;
+    int skipTo = toGate.IsValid() ? (int)toGate.index : -1;
+    return obstacles.Intersects(lineBounds, clearance, skipFrom, skipTo);
 }
 
 // Find alternative route around obstacles
-Vector2 Wire::FindAvoidanceRoute(Vector2 start, Vector2 end, const std::vector<std::unique_ptr<Gate>>& gates, float clearance) const {
+Vector2 Wire::FindAvoidanceRoute(Vector2 start, Vector2 end, const ObstacleGrid& obstacles, float clearance) const {
     float dx = end.x - start.x;
     float dy = end.y - start.y;
 
@@ -160,13 +203,13 @@ Vector2 Wire::FindAvoidanceRoute(Vector2 start, Vector2 end, const std::vector<s
     for (float offset : offsets) {
         // Try horizontal-first with offset
         Vector2 candidate = { start.x + dx * 0.7f, start.y + offset };
-        if (!DoesRouteIntersectGates(start, candidate, { candidate.x, end.y }, end, gates, clearance)) {
+        if (!DoesRouteIntersectGates(start, candidate, { candidate.x, end.y }, end, obstacles, clearance)) {
             return candidate;
         }
 
         // Try vertical-first with offset
         candidate = { start.x + offset, start.y + dy * 0.7f };
-        if (!DoesRouteIntersectGates(start, candidate, { end.x, candidate.y }, end, gates, clearance)) {
+        if (!DoesRouteIntersectGates(start, candidate, { end.x, candidate.y }, end, obstacles, clearance)) {
             return candidate;
         }
     }
@@ -3,6 +3,10 @@
 
 #include "raylib.h"
 #include "raymath.h"
+#include "Constants.h"
+#include "ObstacleGrid.h"
+#include "GeometryBuffer.h"
+#include "SmallVector.h"
 #include <vector>
 #include <memory>
 #include <algorithm>
@@ -17,26 +21,55 @@ class Gate;
 class Wire {
 public:
     // Wire connection data
-    int fromGateIndex;
-    int toGateIndex;
+    GateHandle fromGate;
+    GateHandle toGate;
     int toInputIndex;
-    bool state = false;
+    int fromOutputIndex = 0;   // Output pin of the source (subcircuits have several)
+    BusWord state = 0;         // One lane per bit, like the pins it joins
+    int width = 1;             // Bus width, taken from the source pin
 
-    // L-routing waypoints
-    std::vector<Vector2> waypoints;
+    // Four-valued simulation: lanes that are X (state lane high) or Z (state lane low); see LogicWord
+    BusWord unknown = 0;
+
+    // Heatmap level from toggle coverage: -1 while the heatmap is off, 0 if the
+    // net never toggled, else 1 to HEATMAP_LEVELS by switching activity
+    int heat = -1;
+
+    // On the critical path while it is highlighted (P)
+    bool critical = false;
+
+    // True while the wire shows a straight placeholder waiting for the route worker
+    bool provisional = false;
+
+    // L-routing waypoints, held inline (see WaypointList)
+    WaypointList waypoints;
 
     // Constructor
-    Wire(int from, int to, int inputIdx)
-        : fromGateIndex(from), toGateIndex(to), toInputIndex(inputIdx), state(false) {
+    Wire(GateHandle from, GateHandle to, int inputIdx, int outputIdx = 0)
+        : fromGate(from), toGate(to), toInputIndex(inputIdx), fromOutputIndex(outputIdx), state(0) {
     }
 
+    // Wires are carved from a shared ObjectPool instead of one heap block each
+    // (create and delete them on the UI thread only; stack copies are fine anywhere)
+    static void* operator new(size_t size);
+    static void operator delete(void* pointer, size_t size);
+    static void ReservePool(size_t count);  // Room for count more wires up front
+
+    // Stroke width for drawing
+    float GetThickness() const { return width > 1 ? BUS_WIRE_THICKNESS : WIRE_THICKNESS; }
+
     // Calculate L-shaped route between two points with gate avoidance
-    void CalculateLRoute(Vector2 start, Vector2 end, const std::vector<std::unique_ptr<Gate>>* gates = nullptr) {
+    void CalculateLRoute(Vector2 start, Vector2 end, const GateStore* gates = nullptr);
+
+    // Calculate L-shaped route against a snapshot of gate bounds (see SnapshotGateBounds).
+    // Only reads the snapshot, so it is safe to call from routing threads.
+    void CalculateLRoute(Vector2 start, Vector2 end, const ObstacleGrid& obstacles) {
+        provisional = false;
         waypoints.clear();
         waypoints.push_back(start);
 
         // If no gates provided, use simple L-routing
-        if (!gates || gates->empty()) {
+        if (obstacles.Empty()) {
             CalculateSimpleLRoute(start, end);
             waypoints.push_back(end);
             return;
@@ -45,7 +78,7 @@ public:
         const float CLEARANCE = 15.0f; // Reasonable clearance for gate avoidance
 
         // Try simple avoidance routing
-        Vector2 avoidanceRoute = CalculateAvoidanceRoute(start, end, *gates, CLEARANCE);
+        Vector2 avoidanceRoute = CalculateAvoidanceRoute(start, end, obstacles, CLEARANCE);
 
         if (avoidanceRoute.x != -1) {
             // Use the avoidance route
@@ -60,9 +93,36 @@ public:
         waypoints.push_back(end);
     }
 
+    // Replace the route with a straight provisional segment while a real route is pending
+    void SetProvisionalRoute(Vector2 start, Vector2 end) {
+        waypoints.clear();
+        waypoints.push_back(start);
+        waypoints.push_back(end);
+        provisional = true;
+    }
+
     // Draw the wire with L-routing
     void Draw(Color wireColor) const;
 
+    // Batched rendering: emit the same picture as Draw() into a geometry buffer
+    void AppendGeometry(GeometryBuffer& buffer, Color wireColor) const;
+
+    // Zoomed-out level of detail: segments only, no joints
+    void AppendSimplifiedGeometry(GeometryBuffer& buffer, Color wireColor) const;
+
+    // Bounding box of the route
+    Rectangle GetBounds() const {
+        if (waypoints.empty()) return { 0, 0, 0, 0 };
+        float minX = waypoints[0].x, minY = waypoints[0].y, maxX = minX, maxY = minY;
+        for (const Vector2& point : waypoints) {
+            minX = std::min(minX, point.x);
+            minY = std::min(minY, point.y);
+            maxX = std::max(maxX, point.x);
+            maxY = std::max(maxY, point.y);
+        }
+        return { minX, minY, maxX - minX, maxY - minY };
+    }
+
     // Check if mouse position is near the wire path
     bool IsNearWirePath(Vector2 mousePos, float threshold = 10.0f) const {
         if (waypoints.size() < 2) return false;
@@ -85,17 +145,17 @@ private:
     bool DoesLineIntersectRect(Vector2 start, Vector2 end, Rectangle rect) const;
 
     // Calculate route that avoids gates
-    Vector2 CalculateAvoidanceRoute(Vector2 start, Vector2 end, const std::vector<std::unique_ptr<Gate>>& gates, float clearance) const;
+    Vector2 CalculateAvoidanceRoute(Vector2 start, Vector2 end, const ObstacleGrid& obstacles, float clearance) const;
 
     // Check if the L-route intersects with any gates
     bool DoesRouteIntersectGates(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4,
-        const std::vector<std::unique_ptr<Gate>>& gates, float clearance) const;
+        const ObstacleGrid& obstacles, float clearance) const;
 
     // Check if a line segment intersects with any gates
-    bool DoesLineIntersectGates(Vector2 start, Vector2 end, const std::vector<std::unique_ptr<Gate>>& gates, float clearance) const;
+    bool DoesLineIntersectGates(Vector2 start, Vector2 end, const ObstacleGrid& obstacles, float clearance) const;
 
     // Find alternative route around obstacles
-    Vector2 FindAvoidanceRoute(Vector2 start, Vector2 end, const std::vector<std::unique_ptr<Gate>>& gates, float clearance) const;
+    Vector2 FindAvoidanceRoute(Vector2 start, Vector2 end, const ObstacleGrid& obstacles, float clearance) const;
 
     // Helper function to check distance from point to line segment
     float DistanceToLineSegment(Vector2 point, Vector2 lineStart, Vector2 lineEnd) const;
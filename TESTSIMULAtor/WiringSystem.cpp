@@ -1,16 +1,19 @@
 #include "WiringSystem.h"
 #include <algorithm>
+#include <thread>
+#include <atomic>
+#include <cmath>
 
 // ================================
 // WIRING SYSTEM CLASS IMPLEMENTATION
 // ================================
 
 // Find connection point near mouse position
-ConnectionPoint* WiringSystem::FindConnectionPoint(Vector2 mousePos, const std::vector<std::unique_ptr<Gate>>& gates) {
-    static ConnectionPoint foundPoint({ 0, 0 }, false, -1);
+ConnectionPoint* WiringSystem::FindConnectionPoint(Vector2 mousePos, const GateStore& gates) {
+    static ConnectionPoint foundPoint({ 0, 0 }, false, GateHandle());
 
-    for (int i = 0; i < gates.size(); i++) {
-        auto points = gates[i]->GetConnectionPoints(i);
+    for (size_t i = 0; i < gates.size(); i++) {
+        auto points = gates[i]->GetConnectionPoints(gates.HandleAt(i));
         for (const auto& point : points) {
             float distance = Vector2Distance(mousePos, point.position);
             if (distance <= CONNECTION_SNAP_DISTANCE) {
@@ -23,14 +26,14 @@ ConnectionPoint* WiringSystem::FindConnectionPoint(Vector2 mousePos, const std::
 }
 
 // Handle wire creation
-bool WiringSystem::HandleWireClick(Vector2 mousePos, const std::vector<std::unique_ptr<Gate>>& gates) {
+bool WiringSystem::HandleWireClick(Vector2 mousePos, const GateStore& gates, WireRecord* createdWire) {
     ConnectionPoint* clickedPoint = FindConnectionPoint(mousePos, gates);
 
     if (!clickedPoint) {
         // Clicked empty space, cancel wire creation
         if (isCreatingWire) {
             isCreatingWire = false;
-            wireSourceGate = -1;
+            wireSourceGate = GateHandle();
             return true;
         }
         return false;
@@ -40,59 +43,137 @@ bool WiringSystem::HandleWireClick(Vector2 mousePos, const std::vector<std::uniq
         // Start wire creation - must click on output point
         if (!clickedPoint->isInput) {
             isCreatingWire = true;
-            wireSourceGate = clickedPoint->gateIndex;
+            wireSourceGate = clickedPoint->gate;
+            wireSourceOutput = clickedPoint->inputIndex;
+            previewObstacles.Build(SnapshotGateBounds(gates));
+            previewGateCount = gates.size();
             return true;
         }
     }
     else {
         // Complete wire creation - must click on input point
-        if (clickedPoint->isInput && clickedPoint->gateIndex != wireSourceGate) {
-            // Check if this input is already connected
-            bool alreadyConnected = false;
-            for (const auto& wire : wires) {
-                if (wire->toGateIndex == clickedPoint->gateIndex &&
-                    wire->toInputIndex == clickedPoint->inputIndex) {
-                    alreadyConnected = true;
-                    break;
-                }
-            }
-
-            if (!alreadyConnected) {
+        const std::unique_ptr<Gate>* source = gates.Get(wireSourceGate);
+        const std::unique_ptr<Gate>* target = gates.Get(clickedPoint->gate);
+        if (source && target) {
+            // Check the input is free and of the same width as the source
+            if (CanConnectTo(gates, *clickedPoint)) {
                 // Create the wire
-                auto newWire = std::make_unique<Wire>(wireSourceGate, clickedPoint->gateIndex, clickedPoint->inputIndex);
+                auto newWire = std::make_unique<Wire>(wireSourceGate, clickedPoint->gate, clickedPoint->inputIndex, wireSourceOutput);
+                newWire->width = (*source)->GetOutputWidth(wireSourceOutput);
 
                 // Calculate L-route with gate avoidance for the new wire
-                Vector2 startPos = gates[wireSourceGate]->GetOutputPoint();
-                Vector2 endPos = gates[clickedPoint->gateIndex]->GetInputPoint(clickedPoint->inputIndex);
+                Vector2 startPos = (*source)->GetOutputPoint(wireSourceOutput);
+                Vector2 endPos = (*target)->GetInputPoint(clickedPoint->inputIndex);
                 newWire->CalculateLRoute(startPos, endPos, &gates);
 
-                wires.push_back(std::move(newWire));
+                WireHandle handle = AddWire(std::move(newWire), gates, &loopWarning);
+                routeRevision++;
+
+                if (createdWire) {
+                    const Wire& wire = **wires.Get(handle);
+                    *createdWire = { handle, wire.fromGate, wire.toGate, wire.toInputIndex, wire.fromOutputIndex, wire.width, wire.waypoints };
+                }
             }
         }
 
         // End wire creation regardless
         isCreatingWire = false;
-        wireSourceGate = -1;
+        wireSourceGate = GateHandle();
         return true;
     }
 
     return false;
 }
 
+// Wire two pins directly
+WireHandle WiringSystem::Connect(const GateStore& gates, GateHandle from, int fromOutput, GateHandle to, int toInput) {
+    if (!CanConnect(gates, from, fromOutput, to, toInput)) return WireHandle();
+
+    const Gate& source = **gates.Get(from);
+    auto wire = std::make_unique<Wire>(from, to, toInput, fromOutput);
+    wire->width = source.GetOutputWidth(fromOutput);
+    wire->SetProvisionalRoute(source.GetOutputPoint(fromOutput), (*gates.Get(to))->GetInputPoint(toInput));
+    routeRevision++;
+    return AddWire(std::move(wire), gates);
+}
+
+// Remove every wire
+void WiringSystem::Clear() {
+    CancelPendingRoutes();
+    wires.Clear();
+    gateWires.clear();
+    timing.Clear();
+    topology.Clear();
+    criticalNodes.clear();
+    criticalWires.clear();
+    isCreatingWire = false;
+    wireSourceGate = GateHandle();
+    routeRevision++;
+    stateRevision++;
+}
+
+// Put the topological order right after a bulk load
+void WiringSystem::EndBulkConnect() {
+    if (!bulkConnect) return;
+    bulkConnect = false;
+    topology.Rebuild();
+}
+
+// Room for a bulk load
+void WiringSystem::Reserve(size_t wireCount, size_t gateSlots) {
+    wires.Reserve(wires.size() + wireCount);
+    Wire::ReservePool(wireCount);
+    if (gateWires.size() < gateSlots) gateWires.resize(gateSlots);
+    topology.Reserve(gateSlots);
+    timing.Reserve(gateSlots);
+}
+
 // Handle wire deletion
-bool WiringSystem::HandleWireDeletion(Vector2 mousePos, const std::vector<std::unique_ptr<Gate>>& gates) {
+bool WiringSystem::HandleWireDeletion(Vector2 mousePos, const GateStore& gates, WireRecord* removedWire) {
     // Find wire close to mouse position using the new IsNearWirePath method
-    for (int i = 0; i < wires.size(); i++) {
+    for (size_t i = 0; i < wires.size(); i++) {
         if (wires[i]->IsNearWirePath(mousePos, 10.0f)) {
-            wires.erase(wires.begin() + i);
-            return true;
+            return DeleteWire(wires.HandleAt(i), removedWire);
         }
     }
     return false;
 }
 
+// Delete one wire
+bool WiringSystem::DeleteWire(WireHandle handle, WireRecord* removed) {
+    if (!wires.Contains(handle)) return false;
+
+    CancelPendingRoutes();
+    RemoveWire(handle, removed);
+    routeRevision++;
+    return true;
+}
+
+// Bring a deleted wire back under its old handle
+bool WiringSystem::RestoreWire(const WireRecord& record, const GateStore& gates) {
+    auto wire = std::make_unique<Wire>(record.fromGate, record.toGate, record.toInputIndex, record.fromOutputIndex);
+    wire->width = record.width;
+    wire->waypoints = record.waypoints;
+    if (!wires.Restore(record.handle, std::move(wire))) return false;
+
+    LinkWire(record.fromGate, record.handle);
+    LinkWire(record.toGate, record.handle);
+    const std::unique_ptr<Gate>* source = gates.Get(record.fromGate);
+    topology.AddEdge(record.fromGate.index, record.toGate.index, source && IsClocked((*source)->GetType()));
+    timing.AddEdge(record.fromGate.index, record.toGate.index);
+    routeRevision++;
+    return true;
+}
+
 // Update wire states and propagate signals
-void WiringSystem::UpdateSignals(std::vector<std::unique_ptr<Gate>>& gates) {
+void WiringSystem::UpdateSignals(GateStore& gates) {
+    // Remember gate states so changes can be reported through stateRevision
+    previousGateStates.resize(gates.size());
+    for (size_t i = 0; i < gates.size(); i++) {
+        previousGateStates[i] = gates[i]->GetStateSignature();
+    }
+    bool changed = false;
+
     // First, compute outputs for INPUT gates only (they don't depend on inputs)
     for (auto& gate : gates) {
         if (gate->GetType() == GateType::INPUT) {
@@ -100,25 +181,26 @@ void WiringSystem::UpdateSignals(std::vector<std::unique_ptr<Gate>>& gates) {
         }
         else {
             // Reset inputs for non-INPUT gates
-            gate->input1 = false;
-            gate->input2 = false;
+            gate->ResetInputs();
         }
     }
 
     // Propagate signals through wires
     for (auto& wire : wires) {
-        if (wire->fromGateIndex < gates.size() && wire->toGateIndex < gates.size()) {
+        const std::unique_ptr<Gate>* source = gates.Get(wire->fromGate);
+        std::unique_ptr<Gate>* target = gates.Get(wire->toGate);
+        if (source && target) {
             // Get the current output state from source gate
-            bool signal = gates[wire->fromGateIndex]->output;
+            BusWord signal = (*source)->GetOutputState(wire->fromOutputIndex);
+            if (wire->state != signal || wire->unknown) {
+                changed = true;
+                AddChangedRegion(wire->GetBounds());
+            }
             wire->state = signal;  // Update wire visual state
+            wire->unknown = 0;     // Per-frame stepping is two-valued
 
             // Apply signal to destination gate input
-            if (wire->toInputIndex == 0) {
-                gates[wire->toGateIndex]->input1 = signal;
-            }
-            else if (wire->toInputIndex == 1) {
-                gates[wire->toGateIndex]->input2 = signal;
-            }
+            (*target)->SetInputState(wire->toInputIndex, signal);
         }
     }
 
@@ -128,96 +210,656 @@ void WiringSystem::UpdateSignals(std::vector<std::unique_ptr<Gate>>& gates) {
             gate->ComputeOutput();
         }
     }
+
+    // Each frame is one clock cycle: clocked gates all load together at its end
+    for (auto& gate : gates) {
+        gate->ClockEdge();
+    }
+
+    for (size_t i = 0; i < gates.size(); i++) {
+        if (gates[i]->GetStateSignature() != previousGateStates[i]) {
+            changed = true;
+            AddChangedRegion(gates[i]->GetBounds());
+        }
+    }
+    if (changed) stateRevision++;
 }
 
-// Draw all wires
-void WiringSystem::DrawWires(const std::vector<std::unique_ptr<Gate>>& gates, Vector2 mousePos) {
-    // Draw existing wires using their L-routing
-    for (const auto& wire : wires) {
-        if (wire->fromGateIndex < gates.size() && wire->toGateIndex < gates.size()) {
-            Color wireColor = wire->state ? RED : DARKGRAY;
-            wire->Draw(wireColor);
+// Threaded simulation: take pin and wire values from the simulation thread's nets
+void WiringSystem::ApplyNetValues(GateStore& gates, const std::vector<GateHandle>& nodeGates,
+    const CompiledCircuit& circuit, const std::vector<BusWord>& nets, const std::vector<BusWord>* unknown) {
+    if ((int)nets.size() < circuit.netCount || circuit.nodeOutputNets.size() < nodeGates.size()) return;
+    if (unknown && (int)unknown->size() < circuit.netCount) unknown = nullptr;
+    bool changed = false;
+
+    for (size_t n = 0; n < nodeGates.size(); n++) {
+        std::unique_ptr<Gate>* gate = gates.Get(nodeGates[n]);
+        if (!gate) continue;  // Deleted since the circuit was compiled
+
+        unsigned long long before = (*gate)->GetStateSignature();
+        int firstPin = circuit.nodeInputPins[n];
+        int inputCount = circuit.nodeInputPins[n + 1] - firstPin;
+        for (int i = 0; i < inputCount; i++) {
+            (*gate)->SetInputState(i, nets[circuit.inputPinNets[firstPin + i]]);
+        }
+        int outputCount = (*gate)->GetOutputCount();
+        for (int o = 0; o < outputCount; o++) {
+            (*gate)->SetOutputState(o, nets[circuit.nodeOutputNets[n] + o]);
+        }
+        if ((*gate)->GetType() == GateType::OUTPUT) {
+            (*gate)->SetOutputState(0, (*gate)->GetInputState(0));  // Shows what it reads
+        }
+
+        // Four-valued: mark pins with unknown lanes, and which of those float
+        unsigned long long unknownPins = 0, floatingPins = 0;
+        if (unknown) {
+            auto mark = [&](int bit, int net, int width) {
+                BusWord lanes = (*unknown)[net] & BusMask(width);
+                if (bit >= 64 || lanes == 0) return;
+                unknownPins |= 1ULL << bit;
+                if (lanes & ~nets[net]) floatingPins |= 1ULL << bit;
+            };
+            for (int i = 0; i < inputCount; i++) {
+                mark(i, circuit.inputPinNets[firstPin + i], (*gate)->GetInputWidth(i));
+            }
+            for (int o = 0; o < outputCount; o++) {
+                mark(Gate::OUTPUT_PIN_BIT + o, circuit.nodeOutputNets[n] + o, (*gate)->GetOutputWidth(o));
+            }
+            for (WireHandle handle : WiresAt(nodeGates[n])) {
+                std::unique_ptr<Wire>* wire = wires.Get(handle);
+                if (!wire || (*wire)->fromGate != nodeGates[n]) continue;   // Only wires this node drives
+                int net = circuit.nodeOutputNets[n] + (*wire)->fromOutputIndex;
+                if (net >= circuit.netCount) continue;
+                BusWord lanes = (*unknown)[net] & BusMask((*wire)->width);
+                if ((*wire)->unknown != lanes) {
+                    (*wire)->unknown = lanes;
+                    changed = true;
+                    AddChangedRegion((*wire)->GetBounds());
+                }
+            }
+        }
+        (*gate)->unknownPins = unknownPins;
+        (*gate)->floatingPins = floatingPins;
+
+        if ((*gate)->GetStateSignature() != before) {
+            changed = true;
+            AddChangedRegion((*gate)->GetBounds());
+        }
+    }
+
+    for (auto& wire : wires) {
+        const std::unique_ptr<Gate>* source = gates.Get(wire->fromGate);
+        if (!source) continue;
+        BusWord signal = (*source)->GetOutputState(wire->fromOutputIndex);
+        if (wire->state != signal || (!unknown && wire->unknown)) {
+            wire->state = signal;
+            if (!unknown) wire->unknown = 0;
+            changed = true;
+            AddChangedRegion(wire->GetBounds());
+        }
+    }
+    if (changed) stateRevision++;
+}
+
+// Heatmap level for a net's switching activity
+static int HeatLevel(unsigned long long toggles, unsigned long long transitions, int width) {
+    if (toggles == 0) return 0;
+    double activity = std::max(SwitchingActivity(toggles, transitions, width), HEATMAP_MIN_ACTIVITY);
+    double position = 1.0 - std::log10(activity) / std::log10(HEATMAP_MIN_ACTIVITY);   // 0 at the minimum, 1 every tick
+    return std::min(HEATMAP_LEVELS, 1 + (int)(position * (HEATMAP_LEVELS - 1) + 0.5));
+}
+
+// Heatmap overlay from toggle counts; wires of gates added since the compile stay as they are
+void WiringSystem::ApplyCoverage(const std::vector<GateHandle>& nodeGates, const CompiledCircuit& circuit,
+    const ToggleCoverage& coverage) {
+    if ((int)coverage.NetCount() < circuit.netCount || circuit.nodeOutputNets.size() < nodeGates.size()) return;
+    const std::vector<unsigned long long>& toggles = coverage.Toggles();
+    unsigned long long transitions = coverage.Transitions();
+    bool changed = false;
+
+    for (size_t n = 0; n < nodeGates.size(); n++) {
+        for (WireHandle handle : WiresAt(nodeGates[n])) {
+            std::unique_ptr<Wire>* wire = wires.Get(handle);
+            if (!wire || (*wire)->fromGate != nodeGates[n]) continue;   // Only wires this node drives
+
+            int net = circuit.nodeOutputNets[n] + (*wire)->fromOutputIndex;
+            if (net >= circuit.netCount) continue;
+            int heat = HeatLevel(toggles[net], transitions, circuit.netWidths[net]);
+            if ((*wire)->heat != heat) {
+                (*wire)->heat = heat;
+                changed = true;
+                AddChangedRegion((*wire)->GetBounds());
+            }
+        }
+    }
+    if (changed) stateRevision++;
+}
+
+void WiringSystem::ClearHeatmap() {
+    bool changed = false;
+    for (auto& wire : wires) {
+        if (wire->heat != -1) {
+            wire->heat = -1;
+            changed = true;
+            AddChangedRegion(wire->GetBounds());
+        }
+    }
+    if (changed) stateRevision++;
+}
+
+// Static timing: describe gates new to the timing graph, re-time, and move the highlight
+void WiringSystem::UpdateTiming(const GateStore& gates, bool highlight) {
+    for (int slot : timing.UndescribedNodes()) {
+        const std::unique_ptr<Gate>* gate = gates.AtSlot(slot);
+        if (!gate) continue;
+        GateType type = (*gate)->GetType();
+        const CompiledCircuit* definition = (type == GateType::SUBCIRCUIT) ? SUBCIRCUITS.Get((*gate)->GetDefinition()) : nullptr;
+        float delay = definition ? definition->pathDelay : GateDelay(type);
+        timing.SetNode(slot, delay, IsClocked(type), type == GateType::OUTPUT || IsClocked(type));
+    }
+    timing.Update(&topology.Positions());
+
+    // Wires joining each step of the path
+    criticalNodes.clear();
+    pathScratch.clear();
+    if (highlight) {
+        timing.CriticalPath(criticalNodes);
+        for (size_t i = 0; i + 1 < criticalNodes.size(); i++) {
+            unsigned int to = (unsigned int)criticalNodes[i];
+            unsigned int from = (unsigned int)criticalNodes[i + 1];
+            if (to >= gateWires.size()) continue;
+            for (WireHandle handle : gateWires[to]) {
+                const Wire& wire = **wires.Get(handle);
+                if (wire.toGate.index == to && wire.fromGate.index == from) pathScratch.push_back(handle);
+            }
         }
     }
+    if (pathScratch == criticalWires) return;
+
+    MarkCritical(criticalWires, false);
+    MarkCritical(pathScratch, true);
+    criticalWires.swap(pathScratch);
+    stateRevision++;
+}
+
+bool WiringSystem::TakeLoopWarning() {
+    bool warning = loopWarning;
+    loopWarning = false;
+    return warning;
+}
+
+void WiringSystem::MarkCritical(const std::vector<WireHandle>& handles, bool critical) {
+    for (WireHandle handle : handles) {
+        std::unique_ptr<Wire>* wire = wires.Get(handle);
+        if (!wire || (*wire)->critical == critical) continue;
+        (*wire)->critical = critical;
+        AddChangedRegion((*wire)->GetBounds());
+    }
+}
+
+// Grow the changed region; margin covers pins and wire joints sticking out of the bounds
+void WiringSystem::AddChangedRegion(Rectangle area) {
+    const float MARGIN = 2 * CONNECTION_SNAP_DISTANCE;
+    area = { area.x - MARGIN, area.y - MARGIN, area.width + 2 * MARGIN, area.height + 2 * MARGIN };
+
+    if (!hasChangedRegion) {
+        changedRegion = area;
+        hasChangedRegion = true;
+        return;
+    }
+
+    float minX = std::min(changedRegion.x, area.x);
+    float minY = std::min(changedRegion.y, area.y);
+    float maxX = std::max(changedRegion.x + changedRegion.width, area.x + area.width);
+    float maxY = std::max(changedRegion.y + changedRegion.height, area.y + area.height);
+    changedRegion = { minX, minY, maxX - minX, maxY - minY };
+}
+
+// Take the world area whose signals changed since the last call
+bool WiringSystem::TakeChangedRegion(Rectangle& region) {
+    if (!hasChangedRegion) return false;
+    region = changedRegion;
+    hasChangedRegion = false;
+    return true;
+}
 
+// Draw the wire currently being created
+void WiringSystem::DrawWirePreview(const GateStore& gates, Vector2 mousePos) {
     // Draw temporary wire being created with L-routing preview and gate avoidance
-    if (isCreatingWire && wireSourceGate >= 0 && wireSourceGate < gates.size()) {
-        Vector2 startPos = gates[wireSourceGate]->GetOutputPoint();
+    const std::unique_ptr<Gate>* source = gates.Get(wireSourceGate);
+    if (isCreatingWire && source) {
+        Vector2 startPos = (*source)->GetOutputPoint(wireSourceOutput);
 
-        // Create temporary wire for preview with gate avoidance
-        Wire tempWire(wireSourceGate, -1, 0);
-        tempWire.CalculateLRoute(startPos, mousePos, &gates);
+        // Gates added or removed mid-wire (undo, delete): take fresh bounds
+        if (previewGateCount != gates.size()) {
+            previewObstacles.Build(SnapshotGateBounds(gates));
+            previewGateCount = gates.size();
+        }
+
+        // Temporary wire for preview with gate avoidance; its route is inline, so this allocates nothing
+        Wire tempWire(wireSourceGate, GateHandle(), 0);
+        tempWire.width = (*source)->GetOutputWidth(wireSourceOutput);
+        tempWire.CalculateLRoute(startPos, mousePos, previewObstacles);
         tempWire.Draw(YELLOW);
     }
 }
 
+// Colour for a placed wire based on its signal
+Color WiringSystem::GetWireColor(const Wire& wire) {
+    Color wireColor = wire.state ? RED : DARKGRAY;
+    if (wire.unknown) {
+        // Four-valued: any lane left floating (Z) shows first, then unknown (X)
+        wireColor = (wire.unknown & ~wire.state) ? FLOATING_SIGNAL_COLOR : UNKNOWN_SIGNAL_COLOR;
+    }
+    if (wire.heat == 0) {
+        wireColor = MAGENTA;   // Never toggled: untested logic
+    }
+    else if (wire.heat > 0) {
+        // Cold blue through yellow to hot red
+        float t = (HEATMAP_LEVELS > 1) ? (float)(wire.heat - 1) / (HEATMAP_LEVELS - 1) : 1.0f;
+        auto lerp = [](Color a, Color b, float f) {
+            return Color{ (unsigned char)(a.r + (b.r - a.r) * f), (unsigned char)(a.g + (b.g - a.g) * f),
+                          (unsigned char)(a.b + (b.b - a.b) * f), 255 };
+        };
+        wireColor = (t < 0.5f) ? lerp(BLUE, YELLOW, t * 2) : lerp(YELLOW, RED, t * 2 - 1);
+    }
+    if (wire.critical) wireColor = ORANGE;   // Critical path
+    if (wire.provisional) wireColor = ColorAlpha(wireColor, 0.5f); // Route still pending
+    return wireColor;
+}
+
 // Highlight connection points when in wiring mode
-void WiringSystem::HighlightConnectionPoints(const std::vector<std::unique_ptr<Gate>>& gates, Vector2 mousePos) {
+void WiringSystem::HighlightConnectionPoints(const GateStore& gates, Vector2 mousePos) {
     ConnectionPoint* nearbyPoint = FindConnectionPoint(mousePos, gates);
+    if (!nearbyPoint) return;
 
-    for (int i = 0; i < gates.size(); i++) {
-        auto points = gates[i]->GetConnectionPoints(i);
-        for (const auto& point : points) {
-            bool isNearby = (nearbyPoint && nearbyPoint->gateIndex == point.gateIndex &&
-                nearbyPoint->inputIndex == point.inputIndex &&
-                nearbyPoint->isInput == point.isInput);
-
-            if (isNearby) {
-                Color highlightColor = YELLOW;
-                if (isCreatingWire) {
-                    // Show valid/invalid connections
-                    if (point.isInput && point.gateIndex != wireSourceGate) {
-                        // Check if already connected
-                        bool alreadyConnected = false;
-                        for (const auto& wire : wires) {
-                            if (wire->toGateIndex == point.gateIndex &&
-                                wire->toInputIndex == point.inputIndex) {
-                                alreadyConnected = true;
-                                break;
-                            }
-                        }
-                        highlightColor = alreadyConnected ? RED : GREEN;
-                    }
-                    else {
-                        highlightColor = RED; // Invalid connection
-                    }
-                }
+    const ConnectionPoint& point = *nearbyPoint;
+    Color highlightColor = YELLOW;
+    if (isCreatingWire) {
+        // Show valid/invalid connections
+        // Green for a free input of matching width, orange if the wire would close a
+        // combinational loop, red otherwise
+        bool valid = CanConnectTo(gates, point);
+        highlightColor = valid ? GREEN : RED;
+        const std::unique_ptr<Gate>* source = gates.Get(wireSourceGate);
+        if (valid && source &&
+            topology.WouldCloseLoop(wireSourceGate.index, point.gate.index, IsClocked((*source)->GetType()))) {
+            highlightColor = ORANGE;
+        }
+    }
 
-                DrawCircleV(point.position, CONNECTION_POINT_RADIUS + 3, highlightColor);
-            }
+    DrawCircleV(point.position, CONNECTION_POINT_RADIUS + 3, highlightColor);
+}
+
+// Remove wires connected to a gate (call before the gate is erased)
+void WiringSystem::RemoveWiresForGate(GateHandle gate, std::vector<WireRecord>* removed) {
+    if (WiresAt(gate).empty()) return;
+
+    CancelPendingRoutes();
+    GateWireList attached = WiresAt(gate);
+    for (WireHandle handle : attached) {
+        WireRecord record;
+        RemoveWire(handle, &record);
+        if (removed) removed->push_back(std::move(record));
+    }
+    routeRevision++;
+}
+
+// Recalculate wire routes for a specific gate (when it moves)
+void WiringSystem::RecalculateWiresForGate(GateHandle gate, const GateStore& gates) {
+    ObstacleGrid obstacles(SnapshotGateBounds(gates));
+
+    for (WireHandle handle : WiresAt(gate)) {
+        Wire& wire = **wires.Get(handle);
+        const std::unique_ptr<Gate>* source = gates.Get(wire.fromGate);
+        const std::unique_ptr<Gate>* target = gates.Get(wire.toGate);
+        if (source && target) {
+            Vector2 startPos = (*source)->GetOutputPoint(wire.fromOutputIndex);
+            Vector2 endPos = (*target)->GetInputPoint(wire.toInputIndex);
+            wire.CalculateLRoute(startPos, endPos, obstacles);
         }
     }
+    routeRevision++;
 }
 
-// Remove wires connected to a gate (when gate is deleted)
-void WiringSystem::RemoveWiresForGate(int gateIndex) {
-    wires.erase(
-        std::remove_if(wires.begin(), wires.end(),
-            [gateIndex](const std::unique_ptr<Wire>& wire) {
-                return wire->fromGateIndex == gateIndex || wire->toGateIndex == gateIndex;
-            }),
-        wires.end()
-    );
+// Straighten wires for a moved gate and route them on the background worker
+void WiringSystem::RequestRerouteForGate(GateHandle gate, const GateStore& gates, bool immediate) {
+    std::vector<RouteJob> jobs;
+    pendingRouteWires.clear();
+
+    for (WireHandle handle : WiresAt(gate)) {
+        Wire& wire = **wires.Get(handle);
+        const std::unique_ptr<Gate>* source = gates.Get(wire.fromGate);
+        const std::unique_ptr<Gate>* target = gates.Get(wire.toGate);
+        if (!source || !target) continue;
+
+        Vector2 startPos = (*source)->GetOutputPoint(wire.fromOutputIndex);
+        Vector2 endPos = (*target)->GetInputPoint(wire.toInputIndex);
+
+        // Draw a straight line until the real route comes back
+        wire.SetProvisionalRoute(startPos, endPos);
+
+        jobs.push_back({ wire.fromGate, wire.toGate, startPos, endPos });
+        pendingRouteWires.push_back(handle);
+    }
+
+    if (jobs.empty()) {
+        routeWorker.Cancel();
+        return;
+    }
+
+    // Snapshot gate bounds so the worker never touches live gates
+    routeWorker.Submit(std::move(jobs), SnapshotGateBounds(gates), immediate);
 }
 
-// Update wire indices when gates are rearranged
-void WiringSystem::UpdateWireIndices(int removedIndex) {
-    for (auto& wire : wires) {
-        if (wire->fromGateIndex > removedIndex) wire->fromGateIndex--;
-        if (wire->toGateIndex > removedIndex) wire->toGateIndex--;
+// Install finished background routes
+void WiringSystem::ApplyRouteResults() {
+    RouteResult result;
+    if (!routeWorker.TakeResult(result)) return;
+    if (result.routes.size() != pendingRouteWires.size()) return;
+
+    for (size_t i = 0; i < pendingRouteWires.size(); i++) {
+        std::unique_ptr<Wire>* wire = wires.Get(pendingRouteWires[i]);
+        if (!wire) continue;
+        (*wire)->waypoints = std::move(result.routes[i]);
+        (*wire)->provisional = false;
     }
+    pendingRouteWires.clear();
+    routeRevision++;
 }
 
-// Recalculate wire routes for a specific gate (when it moves)
-void WiringSystem::RecalculateWiresForGate(int gateIndex, const std::vector<std::unique_ptr<Gate>>& gates) {
+// Discard in-flight routes; call before wires are removed
+void WiringSystem::CancelPendingRoutes() {
+    routeWorker.Cancel();
+    pendingRouteWires.clear();
+}
+
+// Wires touching a gate (empty for unknown gates)
+const WiringSystem::GateWireList& WiringSystem::WiresAt(GateHandle gate) const {
+    static const GateWireList none;
+    if (!gate.IsValid() || gate.index >= gateWires.size()) return none;
+    return gateWires[gate.index];
+}
+
+void WiringSystem::LinkWire(GateHandle gate, WireHandle wire) {
+    if (gate.index >= gateWires.size()) gateWires.resize(gate.index + 1);
+    gateWires[gate.index].push_back(wire);
+}
+
+void WiringSystem::UnlinkWire(GateHandle gate, WireHandle wire) {
+    if (gate.index >= gateWires.size()) return;
+    GateWireList& list = gateWires[gate.index];
+    for (size_t i = 0; i < list.size(); i++) {
+        if (list[i] == wire) {
+            list[i] = list.back();
+            list.pop_back();
+            return;
+        }
+    }
+}
+
+// Add one wire and record it on both of its gates
+WireHandle WiringSystem::AddWire(std::unique_ptr<Wire> wire, const GateStore& gates, bool* closedLoop) {
+    GateHandle from = wire->fromGate;
+    GateHandle to = wire->toGate;
+    WireHandle handle = wires.Insert(std::move(wire));
+    LinkWire(from, handle);
+    LinkWire(to, handle);
+    const std::unique_ptr<Gate>* source = gates.Get(from);
+    bool clockedSource = source && IsClocked((*source)->GetType());
+    bool ordered = true;
+    if (bulkConnect) topology.AddEdgeUnordered(from.index, to.index, clockedSource);
+    else ordered = topology.AddEdge(from.index, to.index, clockedSource);
+    if (closedLoop) *closedLoop = !ordered;
+    timing.AddEdge(from.index, to.index);
+    return handle;
+}
+
+// Remove one wire from the store and from both of its gates
+void WiringSystem::RemoveWire(WireHandle handle, WireRecord* removed) {
+    std::unique_ptr<Wire>* wire = wires.Get(handle);
+    if (!wire) return;
+    if (removed) {
+        *removed = { handle, (*wire)->fromGate, (*wire)->toGate, (*wire)->toInputIndex, (*wire)->fromOutputIndex,
+            (*wire)->width, std::move((*wire)->waypoints) };
+    }
+    UnlinkWire((*wire)->fromGate, handle);
+    UnlinkWire((*wire)->toGate, handle);
+    topology.RemoveEdge((*wire)->fromGate.index, (*wire)->toGate.index);
+    timing.RemoveEdge((*wire)->fromGate.index, (*wire)->toGate.index);
+    wires.Erase(handle);
+}
+
+// True if a wire may join these pins
+bool WiringSystem::CanConnect(const GateStore& gates, GateHandle from, int fromOutput, GateHandle to, int toInput) const {
+    if (from == to) return false;
+
+    const std::unique_ptr<Gate>* source = gates.Get(from);
+    const std::unique_ptr<Gate>* target = gates.Get(to);
+    if (!source || !target) return false;
+    if (fromOutput < 0 || fromOutput >= (*source)->GetOutputCount()) return false;
+    if (toInput < 0 || toInput >= (*target)->GetInputCount()) return false;
+
+    // A bus only drives an input of the same width; use a bus gate of that width in between
+    if ((*source)->GetOutputWidth(fromOutput) != (*target)->GetInputWidth(toInput)) return false;
+
+    return !IsInputTaken(to, toInput);
+}
+
+// True if the wire being made may end on this point
+bool WiringSystem::CanConnectTo(const GateStore& gates, const ConnectionPoint& point) const {
+    return point.isInput && CanConnect(gates, wireSourceGate, wireSourceOutput, point.gate, point.inputIndex);
+}
+
+// True if a wire already drives this input
+bool WiringSystem::IsInputTaken(GateHandle gate, int inputIndex) const {
+    for (WireHandle handle : WiresAt(gate)) {
+        const Wire& wire = **wires.Get(handle);
+        if (wire.toGate == gate && wire.toInputIndex == inputIndex) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Route every wire across all cores against one obstacle snapshot
+void WiringSystem::RouteAllWires(const GateStore& gates) {
+    std::vector<WireHandle> handles;
+    handles.reserve(wires.size());
+    for (size_t i = 0; i < wires.size(); i++) {
+        handles.push_back(wires.HandleAt(i));
+    }
+    RouteWires(gates, handles);
+}
+
+// Route a batch of wires across all cores against one obstacle snapshot
+void WiringSystem::RouteWires(const GateStore& gates, const std::vector<WireHandle>& handles) {
+    CancelPendingRoutes();
+
+    // Resolve endpoints up front; routing threads only read the snapshot and write their own wire
+    struct Endpoints { Wire* wire; Vector2 start; Vector2 end; };
+    std::vector<Endpoints> work;
+    work.reserve(handles.size());
+    for (WireHandle handle : handles) {
+        std::unique_ptr<Wire>* found = wires.Get(handle);
+        if (!found) continue;
+        std::unique_ptr<Wire>& wire = *found;
+        const std::unique_ptr<Gate>* source = gates.Get(wire->fromGate);
+        const std::unique_ptr<Gate>* target = gates.Get(wire->toGate);
+        if (source && target) {
+            work.push_back({ wire.get(), (*source)->GetOutputPoint(wire->fromOutputIndex),
+                (*target)->GetInputPoint(wire->toInputIndex) });
+        }
+    }
+
+    const ObstacleGrid obstacles(SnapshotGateBounds(gates));
+
+    // Threads pull small blocks of wires so uneven routes still balance across cores
+    const size_t BLOCK_SIZE = 64;
+    std::atomic<size_t> nextBlock{ 0 };
+    auto routeBlocks = [&]() {
+        while (true) {
+            size_t begin = nextBlock.fetch_add(BLOCK_SIZE);
+            if (begin >= work.size()) return;
+            size_t end = std::min(work.size(), begin + BLOCK_SIZE);
+            for (size_t i = begin; i < end; i++) {
+                work[i].wire->CalculateLRoute(work[i].start, work[i].end, obstacles);
+            }
+        }
+    };
+
+    unsigned int threadCount = std::max(1u, std::thread::hardware_concurrency());
+    if (work.size() < PARALLEL_ROUTE_MIN_WIRES || threadCount == 1) {
+        routeBlocks();
+    }
+    else {
+        std::vector<std::thread> workers;
+        for (unsigned int t = 1; t < threadCount; t++) {
+            workers.emplace_back(routeBlocks);
+        }
+        routeBlocks();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    SeparateOverlappingRoutes();
+    routeRevision++;
+}
+
+// Nudge apart middle segments of different nets that ended up on top of each other
+void WiringSystem::SeparateOverlappingRoutes() {
+    // The middle segment of an L-route (waypoints 1-2) is the only one not pinned to a gate,
+    // so it can slide sideways without breaking orthogonality
+    struct Jog { float lane; float low; float high; int source; Wire* wire; bool vertical; };
+    std::vector<Jog> jogs;
+    jogs.reserve(wires.size());
+
     for (auto& wire : wires) {
-        // Recalculate route if this wire is connected to the moved gate
-        if (wire->fromGateIndex == gateIndex || wire->toGateIndex == gateIndex) {
-            if (wire->fromGateIndex < gates.size() && wire->toGateIndex < gates.size()) {
-                Vector2 startPos = gates[wire->fromGateIndex]->GetOutputPoint();
-                Vector2 endPos = gates[wire->toGateIndex]->GetInputPoint(wire->toInputIndex);
-                wire->CalculateLRoute(startPos, endPos, &gates);
+        if (wire->waypoints.size() != 4) continue;
+        Vector2 a = wire->waypoints[1];
+        Vector2 b = wire->waypoints[2];
+        if (a.x == b.x && a.y != b.y) {
+            jogs.push_back({ a.x, std::min(a.y, b.y), std::max(a.y, b.y), (int)wire->fromGate.index, wire.get(), true });
+        }
+        else if (a.y == b.y && a.x != b.x) {
+            jogs.push_back({ a.y, std::min(a.x, b.x), std::max(a.x, b.x), (int)wire->fromGate.index, wire.get(), false });
+        }
+    }
+
+    // Group jogs sharing an orientation and lane, ordered along the lane
+    std::sort(jogs.begin(), jogs.end(), [](const Jog& l, const Jog& r) {
+        if (l.vertical != r.vertical) return l.vertical < r.vertical;
+        if (l.lane != r.lane) return l.lane < r.lane;
+        return l.low < r.low;
+    });
+
+    struct Track { float high; int source; };
+    std::vector<Track> tracks;
+
+    for (size_t groupStart = 0; groupStart < jogs.size();) {
+        size_t groupEnd = groupStart + 1;
+        while (groupEnd < jogs.size() && jogs[groupEnd].vertical == jogs[groupStart].vertical &&
+            jogs[groupEnd].lane == jogs[groupStart].lane) {
+            groupEnd++;
+        }
+
+        // Greedy interval colouring: reuse the first track that is free or carries the same net
+        tracks.clear();
+        for (size_t i = groupStart; i < groupEnd; i++) {
+            Jog& jog = jogs[i];
+            size_t track = 0;
+            while (track < tracks.size() && tracks[track].high >= jog.low && tracks[track].source != jog.source) {
+                track++;
+            }
+            if (track == tracks.size()) tracks.push_back({ jog.high, jog.source });
+            tracks[track].high = std::max(tracks[track].high, jog.high);
+            tracks[track].source = jog.source;
+
+            if (track == 0) continue;
+
+            // Alternate sides of the original lane: +1, -1, +2, -2, ...
+            float step = (float)((track + 1) / 2) * ROUTE_LANE_SPACING;
+            float shift = (track % 2 == 1) ? step : -step;
+            if (jog.vertical) {
+                jog.wire->waypoints[1].x += shift;
+                jog.wire->waypoints[2].x += shift;
+            }
+            else {
+                jog.wire->waypoints[1].y += shift;
+                jog.wire->waypoints[2].y += shift;
             }
         }
+
+        groupStart = groupEnd;
+    }
+}
+
+// Describe the gates and wires as a netlist
+CircuitDescription WiringSystem::DescribeCircuit(const GateStore& gates, const std::string& name,
+    std::vector<GateHandle>* nodeGates) const {
+    // Ports first (top to bottom, then left to right), then everything else in store order
+    std::vector<int> order;
+    order.reserve(gates.size());
+    for (int i = 0; i < (int)gates.size(); i++) {
+        order.push_back(i);
     }
-}
\ No newline at end of file
+    auto portRank = [&gates](int index) {
+        GateType type = gates[index]->GetType();
+        return type == GateType::INPUT ? 0 : (type == GateType::OUTPUT ? 2 : 1);
+    };
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        int rankA = portRank(a), rankB = portRank(b);
+        if (rankA != rankB) return rankA < rankB;
+        if (rankA == 1) return false;
+        Vector2 pa = gates[a]->position, pb = gates[b]->position;
+        return (pa.y != pb.y) ? pa.y < pb.y : pa.x < pb.x;
+    });
+
+    CircuitDescription description;
+    description.name = name;
+    std::vector<int> nodeOfSlot(gates.SlotCount(), -1);
+    if (nodeGates) nodeGates->clear();
+    for (int index : order) {
+        nodeOfSlot[gates.HandleAt(index).index] = (int)description.nodes.size();
+        if (nodeGates) nodeGates->push_back(gates.HandleAt(index));
+        NetlistNode node;
+        node.type = gates[index]->GetType();
+        node.definition = gates[index]->GetDefinition();
+        node.width = gates[index]->GetWidth();
+        description.nodes.push_back(node);
+    }
+
+    for (const auto& wire : wires) {
+        if (!gates.Contains(wire->fromGate) || !gates.Contains(wire->toGate)) continue;
+        description.edges.push_back({ nodeOfSlot[wire->fromGate.index], wire->fromOutputIndex,
+            nodeOfSlot[wire->toGate.index], wire->toInputIndex });
+    }
+    return description;
+}
+
+// Describe some of the gates and the wires between them
+CircuitDescription WiringSystem::DescribeGates(const GateStore& gates, const std::vector<GateHandle>& selected) const {
+    CircuitDescription description;
+    std::vector<int> nodeOfSlot(gates.SlotCount(), -1);
+    for (GateHandle handle : selected) {
+        const Gate& gate = **gates.Get(handle);
+        nodeOfSlot[handle.index] = (int)description.nodes.size();
+        NetlistNode node;
+        node.type = gate.GetType();
+        node.definition = gate.GetDefinition();
+        node.width = gate.GetWidth();
+        description.nodes.push_back(node);
+    }
+
+    // Each wire is listed on both of its gates; take it from the gate it drives
+    for (GateHandle handle : selected) {
+        for (WireHandle wireHandle : WiresAt(handle)) {
+            const Wire& wire = **wires.Get(wireHandle);
+            if (wire.toGate != handle || !gates.Contains(wire.fromGate) || nodeOfSlot[wire.fromGate.index] < 0) continue;
+            description.edges.push_back({ nodeOfSlot[wire.fromGate.index], wire.fromOutputIndex,
+                nodeOfSlot[handle.index], wire.toInputIndex });
+        }
+    }
+    return description;
+}
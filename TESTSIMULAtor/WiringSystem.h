@@ -5,46 +5,195 @@
 #include "Constants.h"
 #include "Gate.h"
 #include "Wire.h"
+#include "RouteWorker.h"
+#include "Netlist.h"
+#include "Coverage.h"
+#include "StaticTiming.h"
+#include "DynamicTopology.h"
 #include <vector>
 #include <memory>
 
+// Everything needed to put a removed wire back exactly as it was
+struct WireRecord {
+    WireHandle handle;
+    GateHandle fromGate;
+    GateHandle toGate;
+    int toInputIndex = 0;
+    int fromOutputIndex = 0;
+    int width = 1;
+    WaypointList waypoints;
+};
+
 // ================================
 // WIRING SYSTEM CLASS DECLARATION
 // ================================
 class WiringSystem {
 private:
-    std::vector<std::unique_ptr<Wire>> wires;
+    WireStore wires;
     bool isCreatingWire = false;
-    int wireSourceGate = -1;
+    GateHandle wireSourceGate;
+    int wireSourceOutput = 0;
     Vector2 tempWireEnd = { 0, 0 };
 
+    // Gate bounds the preview routes around, taken when a wire is started rather than every frame
+    ObstacleGrid previewObstacles;
+    size_t previewGateCount = 0;
+
+    // Wires touching each gate, indexed by gate slot, so per-gate work never scans every wire.
+    // Most gates have only a few, so the lists live inline.
+    typedef SmallVector<WireHandle, 4> GateWireList;
+    std::vector<GateWireList> gateWires;
+    void LinkWire(GateHandle gate, WireHandle wire);
+    void UnlinkWire(GateHandle gate, WireHandle wire);
+    const GateWireList& WiresAt(GateHandle gate) const;
+
+    // Add or remove one wire, keeping the per-gate lists, topological order and timing in step
+    // (closedLoop, if given, is set when the wire closes a combinational loop)
+    WireHandle AddWire(std::unique_ptr<Wire> wire, const GateStore& gates, bool* closedLoop = nullptr);
+    void RemoveWire(WireHandle handle, WireRecord* removed = nullptr);
+
+    // True if a wire already drives this input
+    bool IsInputTaken(GateHandle gate, int inputIndex) const;
+
+    // True if a wire may join these pins (an output to a free input of the same bus width)
+    bool CanConnect(const GateStore& gates, GateHandle from, int fromOutput, GateHandle to, int toInput) const;
+    bool CanConnectTo(const GateStore& gates, const ConnectionPoint& point) const;  // From the wire being made
+
+    // Change counters so renderers can tell when cached geometry is stale
+    unsigned long long routeRevision = 0;  // Wires added, removed or rerouted
+    unsigned long long stateRevision = 0;  // Any wire or gate signal changed
+    std::vector<unsigned long long> previousGateStates;
+
+    // World area covered by wires and gates whose signals changed since last taken
+    Rectangle changedRegion = { 0, 0, 0, 0 };
+    bool hasChangedRegion = false;
+    void AddChangedRegion(Rectangle area);
+
+    // Background rerouting of wires attached to a dragged gate
+    RouteWorker routeWorker;
+    std::vector<WireHandle> pendingRouteWires;  // Wires waiting on the latest route request, in job order
+
+    // Discard in-flight routes; call before wires are removed
+    void CancelPendingRoutes();
+
+    // Nudge apart middle segments of different nets that ended up on top of each other
+    void SeparateOverlappingRoutes();
+
+    // Topological order of the gate slots, kept current on every wire edit
+    DynamicTopology topology;
+    bool loopWarning = false;                   // The last wire made by clicking closed a combinational loop
+    bool bulkConnect = false;                   // Topology rebuilt by EndBulkConnect instead of per wire
+
+    // Static timing over the gate slots, fed every wire edit as it happens
+    StaticTiming timing;
+    std::vector<int> criticalNodes;             // Gate slots on the critical path, endpoint first
+    std::vector<WireHandle> criticalWires;      // Wires flagged critical
+    std::vector<WireHandle> pathScratch;
+    void MarkCritical(const std::vector<WireHandle>& handles, bool critical);
+
 public:
     // Find connection point near mouse position
-    ConnectionPoint* FindConnectionPoint(Vector2 mousePos, const std::vector<std::unique_ptr<Gate>>& gates);
+    ConnectionPoint* FindConnectionPoint(Vector2 mousePos, const GateStore& gates);
+
+    // Handle wire creation (createdWire receives the record of a new wire, for undo)
+    bool HandleWireClick(Vector2 mousePos, const GateStore& gates, WireRecord* createdWire = nullptr);
+
+    // Handle wire deletion (removedWire receives the deleted wire, for undo)
+    bool HandleWireDeletion(Vector2 mousePos, const GateStore& gates, WireRecord* removedWire = nullptr);
+
+    // Wire two pins directly (loading files); the wire gets a straight placeholder
+    // route until RouteAllWires. Returns an invalid handle if the pins can't connect.
+    WireHandle Connect(const GateStore& gates, GateHandle from, int fromOutput, GateHandle to, int toInput);
 
-    // Handle wire creation
-    bool HandleWireClick(Vector2 mousePos, const std::vector<std::unique_ptr<Gate>>& gates);
+    // Remove every wire (call before clearing the gates)
+    void Clear();
 
-    // Handle wire deletion
-    bool HandleWireDeletion(Vector2 mousePos, const std::vector<std::unique_ptr<Gate>>& gates);
+    // Bulk loads and pastes: between these, Connect leaves the topological order
+    // alone, and EndBulkConnect rebuilds it in one pass
+    void BeginBulkConnect() { bulkConnect = true; }
+    void EndBulkConnect();
+
+    // Make room for wireCount more wires between gates in slots below gateSlots,
+    // so bulk loads allocate once up front
+    void Reserve(size_t wireCount, size_t gateSlots);
+
+    // Undo/redo support: delete a wire, or bring one back under its old handle
+    bool DeleteWire(WireHandle handle, WireRecord* removed = nullptr);
+    bool RestoreWire(const WireRecord& record, const GateStore& gates);
 
     // Update wire states and propagate signals
-    void UpdateSignals(std::vector<std::unique_ptr<Gate>>& gates);
+    void UpdateSignals(GateStore& gates);
 
-    // Draw all wires
-    void DrawWires(const std::vector<std::unique_ptr<Gate>>& gates, Vector2 mousePos);
+    // Threaded simulation: take pin and wire values from the simulation thread's nets.
+    // nodeGates maps the circuit's description nodes to gates (see DescribeCircuit).
+    // unknown, in four-valued simulation, is the nets' unknown plane: X and Z pins and wires are marked.
+    void ApplyNetValues(GateStore& gates, const std::vector<GateHandle>& nodeGates,
+        const CompiledCircuit& circuit, const std::vector<BusWord>& nets,
+        const std::vector<BusWord>* unknown = nullptr);
 
-    // Highlight connection points when in wiring mode
-    void HighlightConnectionPoints(const std::vector<std::unique_ptr<Gate>>& gates, Vector2 mousePos);
+    // True (once) if the last wire made by clicking closed a combinational loop, so the UI can warn
+    bool TakeLoopWarning();
+    size_t GetLoopCount() const { return topology.LoopEdgeCount(); }
+
+    // Heatmap overlay: colour each wire by how often its net toggled, or go back to signal colours
+    void ApplyCoverage(const std::vector<GateHandle>& nodeGates, const CompiledCircuit& circuit,
+        const ToggleCoverage& coverage);
+    void ClearHeatmap();
+
+    // Bring static timing up to date with the edits since the last call (only the
+    // cones they touched are re-timed) and flag the critical path's wires if highlight is on
+    void UpdateTiming(const GateStore& gates, bool highlight);
+    float GetCriticalDelay() const { return timing.CriticalDelay(); }   // Negative if nothing is timed
+    size_t GetCriticalPathGates() const { return criticalNodes.size(); }
+
+    // Draw the wire currently being created (placed wires are drawn by SceneRenderer)
+    void DrawWirePreview(const GateStore& gates, Vector2 mousePos);
+
+    // Colour for a placed wire based on its signal
+    static Color GetWireColor(const Wire& wire);
+
+    // Accessors for rendering
+    const WireStore& GetWires() const { return wires; }
+    unsigned long long GetRouteRevision() const { return routeRevision; }
+    unsigned long long GetStateRevision() const { return stateRevision; }
 
-    // Remove wires connected to a gate (when gate is deleted)
-    void RemoveWiresForGate(int gateIndex);
+    // Take the world area whose signals changed since the last call (false if none)
+    bool TakeChangedRegion(Rectangle& region);
 
-    // Update wire indices when gates are rearranged
-    void UpdateWireIndices(int removedIndex);
+    // Highlight connection points when in wiring mode
+    void HighlightConnectionPoints(const GateStore& gates, Vector2 mousePos);
+
+    // Remove wires connected to a gate (call before the gate is erased);
+    // removed receives the deleted wires, for undo
+    void RemoveWiresForGate(GateHandle gate, std::vector<WireRecord>* removed = nullptr);
 
     // Recalculate wire routes for a specific gate (when it moves)
-    void RecalculateWiresForGate(int gateIndex, const std::vector<std::unique_ptr<Gate>>& gates);
+    void RecalculateWiresForGate(GateHandle gate, const GateStore& gates);
+
+    // Straighten wires for a moved gate and route them on the background worker.
+    // The moved gate's wires are drawn live while it is dragged, so only the
+    // arriving results bump routeRevision.
+    void RequestRerouteForGate(GateHandle gate, const GateStore& gates, bool immediate = false);
+
+    // Install finished background routes (call once per frame from the UI thread)
+    void ApplyRouteResults();
+    bool HasPendingRoutes() const { return !pendingRouteWires.empty(); }
+
+    // Route every wire across all cores against one obstacle snapshot (after import or R key)
+    void RouteAllWires(const GateStore& gates);
+
+    // The same for just these wires (the ones a paste made)
+    void RouteWires(const GateStore& gates, const std::vector<WireHandle>& handles);
+
+    // Describe the gates and wires as a netlist (for making subcircuit definitions or
+    // simulating the canvas). INPUT and OUTPUT gates become ports, ordered top to bottom,
+    // then left to right. nodeGates receives the gate behind each node.
+    CircuitDescription DescribeCircuit(const GateStore& gates, const std::string& name,
+        std::vector<GateHandle>* nodeGates = nullptr) const;
+
+    // Describe some of the gates and only the wires between them (for copying a
+    // selection); node i is selected[i], which must be a live gate listed once
+    CircuitDescription DescribeGates(const GateStore& gates, const std::vector<GateHandle>& selected) const;
 };
 
 #endif // WIRING_SYSTEM_H
\ No newline at end of file
@@ -4,13 +4,44 @@
 #include "Gate.h"
 #include "Sidebar.h"
 #include "WiringSystem.h"
+#include "SceneRenderer.h"
+#include "Viewport.h"
+#include "CanvasCache.h"
+#include "EditHistory.h"
+#include "SimulationThread.h"
+#include "CircuitFile.h"
+#include "Checkpoint.h"
+#include "Coverage.h"
+#include "Selection.h"
+#include "AutoPlace.h"
+#include <fstream>
 #include <iostream>
 #include <vector>
 #include <memory>
 #include <string>
+#include <cmath>
+#include <cstdio>
 
 using namespace std;
 
+// True if the user did anything this frame; a held key or button counts, so held actions keep going
+static bool HadInput() {
+    Vector2 delta = GetMouseDelta();
+    if (delta.x != 0 || delta.y != 0 || GetMouseWheelMove() != 0 || IsWindowResized()) return true;
+    for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_MIDDLE; button++) {
+        if (IsMouseButtonDown(button) || IsMouseButtonReleased(button)) return true;
+    }
+    for (int key = KEY_SPACE; key <= KEY_KB_MENU; key++) {
+        if (IsKeyDown(key) || IsKeyReleased(key)) return true;
+    }
+    return false;
+}
+
+// Rectangle with corners at two points, in any order
+static Rectangle RectBetween(Vector2 a, Vector2 b) {
+    return { fminf(a.x, b.x), fminf(a.y, b.y), fabsf(b.x - a.x), fabsf(b.y - a.y) };
+}
+
 // ================================
 // MAIN FUNCTION
 // ================================
@@ -24,40 +55,76 @@ int main() {
     
     // Load gate textures
     LoadGateTextures();
-    
-    std::cout << "Gate textures loaded - checking texture IDs:" << std::endl;
-    for (const auto& pair : GATE_DATA) {
-        std::cout << "  " << pair.second.label << ": texture ID = " << pair.second.texture.id << std::endl;
-    }
 
     // ================================
     // GAME STATE VARIABLES
     // ================================
-    vector<unique_ptr<Gate>> gates;
+    GateStore gates;
     Sidebar sidebar;
     WiringSystem wiringSystem;
+    SceneRenderer sceneRenderer;
+    Viewport viewport;
+    CanvasCache canvasCache;
+    EditHistory history;
+
+    // Simulation runs on its own thread against the canvas compiled to a netlist;
+    // T switches back to stepping once per frame on the UI thread
+    int tickRateIndex = SIMULATION_DEFAULT_TICK_RATE;
+    SimulationThread simulation(SUBCIRCUITS, SIMULATION_TICK_RATES[tickRateIndex]);
+    bool threadedSimulation = true;
+    bool netlistDirty = true;                   // Gates or wires changed since the last compile
+    shared_ptr<const CompiledCircuit> simCircuit;
+    CircuitDescription simDescription;          // What simCircuit was compiled from
+    vector<GateHandle> simNodeGates;            // Gate behind each netlist node
+    vector<int> simInputNodes;                  // Nodes that are INPUT gates
+    vector<BusWord> simSentInputs;              // Last value sent for each of simInputNodes
+    unsigned long long simVersion = 0;
+    bool showHeatmap = false;                   // Wires coloured by toggle activity (H)
+    bool showCriticalPath = false;              // Longest path highlighted by static timing (P)
+    bool fourValued = false;                    // Nets carry 0/1/X/Z, floating and unknown ones marked (X)
 
     SimulatorMode currentMode = SimulatorMode::PLACEMENT;
     bool hasSelectedGate = false;
     GateType selectedGateType = GateType::INPUT;
-    int draggedGateIndex = -1;
+    int selectedDefinition = -1;    // Subcircuit to place when selectedGateType is SUBCIRCUIT
+    int selectedWidth = 1;          // Bus width of newly placed primitive gates
+    GateHandle draggedGate;
     Vector2 dragOffset = { 0, 0 };
+    Vector2 dragStartPosition = { 0, 0 };
+    bool dragMoved = false;
     bool showGrid = SHOW_GRID_DEFAULT;
+    vector<GateHandle> selection;   // Gates picked by dragging a rectangle over empty canvas
+    bool selecting = false;         // Rectangle being dragged out from selectionStart
+    Vector2 selectionStart = { 0, 0 };
+    CircuitClip clipboard;          // Last Ctrl+C
+    int replicateCopies = 8;        // Copies made by Ctrl+D
+    string fileStatus;              // Result of the last save/load, shown in the status bar
+    bool waitingForEvents = false;  // Idle: EndDrawing sleeps until the next input
 
     // ================================
     // MAIN GAME LOOP
     // ================================
     while (!WindowShouldClose()) {
         Vector2 mousePos = GetMousePosition();
+        unsigned long long frameStateRevision = wiringSystem.GetStateRevision();
+        unsigned long long frameRouteRevision = wiringSystem.GetRouteRevision();
+
+        // Pan/zoom the canvas; everything placed on it works in world coordinates
+        bool panning = viewport.Update(mousePos);
+        sidebar.Update(mousePos, currentMode);
+        Vector2 worldMouse = viewport.ScreenToWorld(mousePos);
 
         // ================================
         // INPUT HANDLING
         // ================================
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        bool ctrlDown = IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL);
+        bool shiftDown = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !panning && !IsKeyDown(KEY_SPACE)) {
             // Check sidebar button clicks
             bool shouldDeselect = false;
             bool shouldToggleMode = false;
-            GateType clickedGate = sidebar.CheckButtonClick(mousePos, shouldDeselect, shouldToggleMode, currentMode);
+            int clickedDefinition = -1;
+            GateType clickedGate = sidebar.CheckButtonClick(mousePos, shouldDeselect, shouldToggleMode, currentMode, clickedDefinition);
 
             if (shouldToggleMode) {
                 currentMode = (currentMode == SimulatorMode::PLACEMENT) ? SimulatorMode::WIRING : SimulatorMode::PLACEMENT;
@@ -68,6 +135,7 @@ int main() {
             }
             else if (clickedGate != (GateType)-1) {
                 selectedGateType = clickedGate;
+                selectedDefinition = clickedDefinition;
                 hasSelectedGate = true;
             }
             else if (mousePos.x > SIDEBAR_WIDTH) {
@@ -75,36 +143,47 @@ int main() {
                 if (currentMode == SimulatorMode::PLACEMENT) {
                     // PLACEMENT MODE
                     bool foundGate = false;
+                    selection.clear();
 
                     // Check if clicking on existing gate
-                    for (int i = 0; i < gates.size(); i++) {
-                        if (gates[i]->ContainsPoint(mousePos)) {
-                            // Toggle input states for INPUT gates when clicked
+                    for (size_t i = 0; i < gates.size(); i++) {
+                        if (gates[i]->ContainsPoint(worldMouse)) {
+                            // Toggle input states for INPUT gates when clicked;
+                            // bus inputs count up (Shift+click counts down)
                             if (gates[i]->GetType() == GateType::INPUT) {
-                                gates[i]->input1 = !gates[i]->input1;
+                                gates[i]->StepInputValue(IsKeyDown(KEY_LEFT_SHIFT) ? -1 : 1);
                             }
 
-                            draggedGateIndex = i;
-                            dragOffset.x = mousePos.x - gates[i]->position.x;
-                            dragOffset.y = mousePos.y - gates[i]->position.y;
+                            draggedGate = gates.HandleAt(i);
+                            dragMoved = false;
+                            dragStartPosition = gates[i]->position;
+                            dragOffset.x = worldMouse.x - gates[i]->position.x;
+                            dragOffset.y = worldMouse.y - gates[i]->position.y;
                             foundGate = true;
                             break;
                         }
                     }
 
+                    // Empty canvas with no gate type selected (or with Ctrl) starts a selection rectangle
+                    if (!foundGate && (!hasSelectedGate || ctrlDown)) {
+                        selecting = true;
+                        selectionStart = worldMouse;
+                    }
+
                     // Place new gate if no existing gate was clicked and a gate type is selected
-                    if (!foundGate && hasSelectedGate) {
-                        Vector2 gateSize = GATE_DATA.at(selectedGateType).size;
-                        Vector2 newPos = { mousePos.x - gateSize.x / 2, mousePos.y - gateSize.y / 2 };
+                    else if (!foundGate && hasSelectedGate) {
+                        auto newGate = make_unique<Gate>(selectedGateType, Vector2{ 0, 0 }, selectedDefinition, selectedWidth);
+                        Vector2 gateSize = newGate->GetSize();
+                        Vector2 newPos = { worldMouse.x - gateSize.x / 2, worldMouse.y - gateSize.y / 2 };
 
                         // Optional grid snapping (like Proteus)
                         if (showGrid && IsKeyDown(KEY_LEFT_SHIFT)) {
                             // Snap to grid when holding Shift
-                            newPos.x = ((int)(newPos.x / GRID_SIZE)) * GRID_SIZE;
-                            newPos.y = ((int)(newPos.y / GRID_SIZE)) * GRID_SIZE;
+                            newPos.x = floorf(newPos.x / GRID_SIZE) * GRID_SIZE;
+                            newPos.y = floorf(newPos.y / GRID_SIZE) * GRID_SIZE;
                         }
 
-                        auto newGate = make_unique<Gate>(selectedGateType, newPos);
+                        newGate->position = newPos;
 
                         // Check if we can place it (no overlaps)
                         bool canPlace = true;
@@ -116,48 +195,366 @@ int main() {
                         }
 
                         if (canPlace) {
-                            gates.push_back(move(newGate));
+                            const Gate& placed = *newGate;
+                            history.RecordPlace(gates.Insert(move(newGate)), placed);
+                            sceneRenderer.MarkGatesDirty();
+                            netlistDirty = true;
                         }
                     }
                 }
                 else {
                     // WIRING MODE
-                    wiringSystem.HandleWireClick(mousePos, gates);
+                    WireRecord createdWire;
+                    wiringSystem.HandleWireClick(worldMouse, gates, &createdWire);
+                    if (createdWire.handle.IsValid()) {
+                        history.RecordAddWire(createdWire);
+                        netlistDirty = true;
+                        if (wiringSystem.TakeLoopWarning()) {
+                            fileStatus = "Warning: wire closes a combinational loop";
+                        }
+                    }
                 }
             }
         }
 
         // Handle right-click for wire deletion in wiring mode
         if (IsMouseButtonPressed(MOUSE_RIGHT_BUTTON) && currentMode == SimulatorMode::WIRING && mousePos.x > SIDEBAR_WIDTH) {
-            wiringSystem.HandleWireDeletion(mousePos, gates);
+            WireRecord removedWire;
+            if (wiringSystem.HandleWireDeletion(worldMouse, gates, &removedWire)) {
+                history.RecordRemoveWire(move(removedWire));
+                netlistDirty = true;
+            }
         }
 
         // Handle gate dragging (only in placement mode)
         if (currentMode == SimulatorMode::PLACEMENT) {
-            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON) && draggedGateIndex != -1) {
-                Vector2 oldPosition = gates[draggedGateIndex]->position;
-                gates[draggedGateIndex]->position.x = mousePos.x - dragOffset.x;
-                gates[draggedGateIndex]->position.y = mousePos.y - dragOffset.y;
+            unique_ptr<Gate>* dragged = gates.Get(draggedGate);
+            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON) && dragged) {
+                Vector2 oldPosition = (*dragged)->position;
+                (*dragged)->position.x = worldMouse.x - dragOffset.x;
+                (*dragged)->position.y = worldMouse.y - dragOffset.y;
                 
                 // Only recalculate wire routes if the gate actually moved
-                Vector2 newPosition = gates[draggedGateIndex]->position;
+                Vector2 newPosition = (*dragged)->position;
                 if (Vector2Distance(oldPosition, newPosition) > 1.0f) {
-                    // Recalculate routes for wires connected to this gate
-                    wiringSystem.RecalculateWiresForGate(draggedGateIndex, gates);
+                    // Reroute wires connected to this gate in the background
+                    wiringSystem.RequestRerouteForGate(draggedGate, gates);
+                    dragMoved = true;
                 }
             }
 
             if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
-                draggedGateIndex = -1;
+                // Route the final position right away instead of waiting out the debounce,
+                // and record the whole drag as one move
+                if (dragged && dragMoved) {
+                    wiringSystem.RequestRerouteForGate(draggedGate, gates, true);
+                    history.RecordMove(draggedGate, dragStartPosition, (*dragged)->position);
+                }
+                draggedGate = GateHandle();
+                dragMoved = false;
+
+                // Select every gate the rectangle touches
+                if (selecting) {
+                    SelectGatesInRect(gates, RectBetween(selectionStart, worldMouse), selection);
+                    selecting = false;
+                }
             }
         }
 
         // Handle gate deletion with DELETE key
-        if (IsKeyPressed(KEY_DELETE) && draggedGateIndex != -1) {
-            wiringSystem.RemoveWiresForGate(draggedGateIndex);
-            gates.erase(gates.begin() + draggedGateIndex);
-            wiringSystem.UpdateWireIndices(draggedGateIndex);
-            draggedGateIndex = -1;
+        if (IsKeyPressed(KEY_DELETE) && gates.Contains(draggedGate)) {
+            const Gate& deleted = **gates.Get(draggedGate);
+            if (dragMoved) {
+                history.RecordMove(draggedGate, dragStartPosition, deleted.position);
+                dragMoved = false;
+            }
+
+            vector<WireRecord> removedWires;
+            wiringSystem.RemoveWiresForGate(draggedGate, &removedWires);
+            history.RecordDelete(draggedGate, deleted, move(removedWires));
+            gates.Erase(draggedGate);
+            sceneRenderer.MarkGatesDirty();
+            netlistDirty = true;
+            draggedGate = GateHandle();
+        }
+
+        // DELETE with a selection removes all of it as one undo step
+        else if (IsKeyPressed(KEY_DELETE) && !selection.empty()) {
+            PruneSelection(gates, selection);
+            vector<WireRecord> removedWires;
+            for (GateHandle handle : selection) {
+                wiringSystem.RemoveWiresForGate(handle, &removedWires);
+            }
+            history.RecordDelete(selection, gates, move(removedWires));
+            for (GateHandle handle : selection) {
+                gates.Erase(handle);
+            }
+            selection.clear();
+            sceneRenderer.MarkGatesDirty();
+            netlistDirty = true;
+        }
+
+        // Ctrl shortcuts (not while dragging): undo with Ctrl+Z, redo with Ctrl+Y or Ctrl+Shift+Z
+        if (ctrlDown && !draggedGate.IsValid()) {
+            bool changed = false;
+            if (IsKeyPressed(KEY_Z) && !shiftDown) {
+                changed = history.Undo(gates, wiringSystem);
+            }
+            else if (IsKeyPressed(KEY_Y) || (IsKeyPressed(KEY_Z) && shiftDown)) {
+                changed = history.Redo(gates, wiringSystem);
+            }
+            if (changed) {
+                PruneSelection(gates, selection);
+                sceneRenderer.MarkGatesDirty();
+                netlistDirty = true;
+            }
+
+            // Select everything with Ctrl+A; copy the selection (and the wires inside it) with Ctrl+C
+            if (IsKeyPressed(KEY_A)) {
+                selection.clear();
+                selection.reserve(gates.size());
+                for (size_t i = 0; i < gates.size(); i++) {
+                    selection.push_back(gates.HandleAt(i));
+                }
+            }
+            if (IsKeyPressed(KEY_C) && !selection.empty()) {
+                PruneSelection(gates, selection);
+                clipboard = CopySelection(gates, wiringSystem, selection);
+                fileStatus = "Copied " + to_string(clipboard.circuit.nodes.size()) + " gates, " +
+                    to_string(clipboard.circuit.edges.size()) + " wires";
+            }
+
+            // Paste with Ctrl+V, top-left corner at the mouse (on the grid with Shift), or
+            // replicate the selection with Ctrl+D: replicateCopies more copies, each
+            // stepped from the last by the offset from the selection to the mouse
+            bool paste = IsKeyPressed(KEY_V) && !clipboard.Empty();
+            bool replicate = IsKeyPressed(KEY_D) && !selection.empty();
+            if (paste || replicate) {
+                CircuitClip cell;
+                Vector2 origin = worldMouse, step = { 0, 0 };
+                int copies = 1;
+                if (replicate) {
+                    PruneSelection(gates, selection);
+                    cell = CopySelection(gates, wiringSystem, selection);
+                    step.x = roundf((worldMouse.x - cell.corner.x) / GRID_SIZE) * GRID_SIZE;
+                    step.y = roundf((worldMouse.y - cell.corner.y) / GRID_SIZE) * GRID_SIZE;
+                    origin = Vector2Add(cell.corner, step);
+                    copies = replicateCopies;
+                }
+                else if (showGrid && shiftDown) {
+                    origin.x = floorf(origin.x / GRID_SIZE) * GRID_SIZE;
+                    origin.y = floorf(origin.y / GRID_SIZE) * GRID_SIZE;
+                }
+
+                vector<GateHandle> placed;
+                if (PasteClip(replicate ? cell : clipboard, origin, step, copies, gates, wiringSystem, placed)) {
+                    history.RecordPlace(placed, gates);
+                    selection = move(placed);
+                    sceneRenderer.MarkGatesDirty();
+                    netlistDirty = true;
+                    fileStatus = (replicate ? "Replicated " : "Pasted ") + to_string(copies) +
+                        (copies == 1 ? " copy" : " copies");
+                }
+                else {
+                    fileStatus = "Can't place: copies would overlap gates";
+                }
+            }
+
+            // Save the design with Ctrl+S: the blocks it uses, then the canvas with positions
+            if (IsKeyPressed(KEY_S)) {
+                CircuitFile file;
+                vector<GateHandle> nodeGates;
+                file.circuit = wiringSystem.DescribeCircuit(gates, "canvas", &nodeGates);
+                GatherCircuitBlocks(file, SUBCIRCUITS);
+                for (GateHandle handle : nodeGates) {
+                    Vector2 position = (*gates.Get(handle))->position;
+                    file.positions.push_back({ position.x, position.y });
+                }
+                fileStatus = (SaveCircuitFile(CIRCUIT_FILE_PATH, file) ? "Saved " : "Could not save ") + string(CIRCUIT_FILE_PATH);
+            }
+
+            // Load a design with Ctrl+O, replacing the canvas (blocks the sidebar lacks are added to it)
+            if (IsKeyPressed(KEY_O)) {
+                CircuitFile file;
+                string error = "too many blocks";
+                if (LoadCircuitFile(CIRCUIT_FILE_PATH, file, &error) && LinkCircuitFile(file, SUBCIRCUITS)) {
+                    wiringSystem.Clear();
+                    gates.Clear();
+                    history.Clear();
+
+                    // Size every store for the whole design first: a handful of allocations in total
+                    Gate::ReservePool(file.circuit.nodes.size());
+                    gates.Reserve(file.circuit.nodes.size());
+                    wiringSystem.Reserve(file.circuit.edges.size(), max(gates.SlotCount(), file.circuit.nodes.size()));
+
+                    vector<GateHandle> nodeGates;
+                    nodeGates.reserve(file.circuit.nodes.size());
+                    for (size_t n = 0; n < file.circuit.nodes.size(); n++) {
+                        const NetlistNode& node = file.circuit.nodes[n];
+                        Vector2 position = { file.positions[n].x, file.positions[n].y };
+                        nodeGates.push_back(gates.Insert(make_unique<Gate>(node.type, position, node.definition, node.width)));
+                    }
+
+                    // Netlists saved without positions get laid out in columns by logic level,
+                    // and the view moves to take in the result
+                    if (!file.positioned && !nodeGates.empty()) {
+                        vector<NodeExtent> extents;
+                        extents.reserve(nodeGates.size());
+                        for (GateHandle handle : nodeGates) {
+                            Vector2 size = (*gates.Get(handle))->GetSize();
+                            extents.push_back({ size.x, size.y });
+                        }
+                        vector<NodePosition> placed = PlaceLayered(file.circuit, extents, (float)GRID_SIZE);
+                        Rectangle area = { placed[0].x, placed[0].y, 0, 0 };
+                        for (size_t n = 0; n < nodeGates.size(); n++) {
+                            Gate& gate = **gates.Get(nodeGates[n]);
+                            gate.position = { placed[n].x, placed[n].y };
+                            float right = fmaxf(area.x + area.width, placed[n].x + extents[n].width);
+                            float bottom = fmaxf(area.y + area.height, placed[n].y + extents[n].height);
+                            area.x = fminf(area.x, placed[n].x);
+                            area.y = fminf(area.y, placed[n].y);
+                            area.width = right - area.x;
+                            area.height = bottom - area.y;
+                        }
+                        viewport.Frame(area);
+                    }
+                    wiringSystem.BeginBulkConnect();
+                    for (const NetlistEdge& edge : file.circuit.edges) {
+                        if (edge.fromNode < 0 || edge.fromNode >= (int)nodeGates.size() ||
+                            edge.toNode < 0 || edge.toNode >= (int)nodeGates.size()) continue;
+                        wiringSystem.Connect(gates, nodeGates[edge.fromNode], edge.fromPort, nodeGates[edge.toNode], edge.toPort);
+                    }
+                    wiringSystem.EndBulkConnect();
+                    wiringSystem.RouteAllWires(gates);
+
+                    sceneRenderer.MarkGatesDirty();
+                    netlistDirty = true;
+                    fileStatus = "Loaded " + string(CIRCUIT_FILE_PATH) + (file.positioned ? "" : " (laid out)");
+                }
+                else {
+                    fileStatus = "Could not load " + string(CIRCUIT_FILE_PATH) + ": " + error;
+                }
+            }
+        }
+
+        // Package the whole canvas as a reusable subcircuit block with B key;
+        // its INPUT and OUTPUT gates become the block's ports
+        if (IsKeyPressed(KEY_B) && !ctrlDown && !draggedGate.IsValid()) {
+            CircuitDescription description = wiringSystem.DescribeCircuit(gates, "BLOCK" + to_string(SUBCIRCUITS.Count() + 1));
+            int inputPorts = 0, outputPorts = 0;
+            bool clocked = false;
+            for (const NetlistNode& node : description.nodes) {
+                if (node.type == GateType::INPUT) inputPorts++;
+                if (node.type == GateType::OUTPUT) outputPorts++;
+                if (IsClocked(node.type)) clocked = true;
+            }
+            int definition = (inputPorts > 0 && outputPorts > 0) ? SUBCIRCUITS.Add(description) : -1;
+            if (clocked) {
+                fileStatus = "Blocks can't hold clocked gates";
+            }
+            else if (definition >= 0) {
+                selectedDefinition = definition;
+                selectedGateType = GateType::SUBCIRCUIT;
+                hasSelectedGate = true;
+                currentMode = SimulatorMode::PLACEMENT;
+            }
+        }
+
+        // Halve/double the bus width of new gates with [ and ]
+        if (IsKeyPressed(KEY_LEFT_BRACKET) && selectedWidth > 1) {
+            selectedWidth /= 2;
+        }
+        if (IsKeyPressed(KEY_RIGHT_BRACKET) && selectedWidth < MAX_BUS_WIDTH) {
+            selectedWidth *= 2;
+        }
+
+        // Halve/double the copies Ctrl+D makes with , and .
+        if (IsKeyPressed(KEY_COMMA) && replicateCopies > 1) {
+            replicateCopies /= 2;
+        }
+        if (IsKeyPressed(KEY_PERIOD) && replicateCopies < MAX_REPLICATE_COPIES) {
+            replicateCopies *= 2;
+        }
+
+        // Reroute every wire in one parallel pass with R key
+        if (IsKeyPressed(KEY_R) && !draggedGate.IsValid()) {
+            wiringSystem.RouteAllWires(gates);
+        }
+
+        // Switch between the simulation thread and per-frame stepping with T key
+        if (IsKeyPressed(KEY_T)) {
+            threadedSimulation = !threadedSimulation;
+            netlistDirty = true;
+            if (showHeatmap && simulation.SetCoverage(false)) {
+                showHeatmap = false;
+                wiringSystem.ClearHeatmap();
+            }
+            if (fourValued && simulation.SetFourValued(false)) fourValued = false;
+        }
+
+        // Toggle coverage heatmap with H (simulation thread only); F6 writes the full report
+        if (IsKeyPressed(KEY_H) && threadedSimulation && simulation.SetCoverage(!showHeatmap)) {
+            showHeatmap = !showHeatmap;
+            if (!showHeatmap) wiringSystem.ClearHeatmap();
+        }
+
+        // Four-valued simulation with X (simulation thread only): floating inputs read Z
+        // instead of low, and whatever they reach turns X
+        if (IsKeyPressed(KEY_X) && !ctrlDown && threadedSimulation && simulation.SetFourValued(!fourValued)) {
+            fourValued = !fourValued;
+        }
+
+        // Highlight the critical path with P; it follows edits as they happen
+        if (IsKeyPressed(KEY_P)) {
+            showCriticalPath = !showCriticalPath;
+        }
+
+        // Checkpoint the running simulation with F5 and restore it with F9; the
+        // checkpoint only fits the circuit as it was compiled when it was taken
+        bool simulationCurrent = threadedSimulation && !netlistDirty && simCircuit &&
+            simulation.Latest().version == simVersion;
+        if (IsKeyPressed(KEY_F5) && simulationCurrent) {
+            const SimulationSnapshot& snapshot = simulation.Latest();
+            unsigned long long tick = snapshot.TickNow();
+            string error;
+            fileStatus = SaveCheckpoint(CHECKPOINT_FILE_PATH, *simCircuit, tick, snapshot.nets, &error)
+                ? "Checkpoint at tick " + to_string(tick) : "Could not checkpoint: " + error;
+        }
+        if (IsKeyPressed(KEY_F6) && simulationCurrent && showHeatmap) {
+            ofstream report(COVERAGE_REPORT_PATH);
+            WriteCoverageReport(report, simDescription, *simCircuit, simulation.Latest().CoverageNow());
+            fileStatus = (report ? "Wrote " : "Could not write ") + string(COVERAGE_REPORT_PATH);
+        }
+        if (IsKeyPressed(KEY_F9) && simulationCurrent) {
+            vector<BusWord> nets;
+            unsigned long long tick = 0;
+            string error;
+            if (!LoadCheckpoint(CHECKPOINT_FILE_PATH, *simCircuit, tick, nets, &error)) {
+                fileStatus = "Could not restore: " + error;
+            }
+            else {
+                // INPUT gates hold the values the thread is driven with, so they follow the checkpoint
+                vector<BusWord> restoredInputs;
+                for (int node : simInputNodes) {
+                    restoredInputs.push_back(nets[simCircuit->nodeOutputNets[node]]);
+                }
+                if (simulation.Restore(simVersion, move(nets), tick)) {
+                    for (size_t i = 0; i < simInputNodes.size(); i++) {
+                        unique_ptr<Gate>* gate = gates.Get(simNodeGates[simInputNodes[i]]);
+                        if (gate) (*gate)->input1 = restoredInputs[i];
+                        simSentInputs[i] = restoredInputs[i];
+                    }
+                    fileStatus = "Restored tick " + to_string(tick);
+                }
+            }
+        }
+
+        // Slow down/speed up the simulation thread with - and =
+        int newTickRate = tickRateIndex;
+        if (IsKeyPressed(KEY_MINUS) && newTickRate > 0) newTickRate--;
+        if (IsKeyPressed(KEY_EQUAL) && newTickRate < SIMULATION_TICK_RATE_COUNT - 1) newTickRate++;
+        if (newTickRate != tickRateIndex && simulation.SetTickRate(SIMULATION_TICK_RATES[newTickRate])) {
+            tickRateIndex = newTickRate;
         }
 
         // Handle grid toggle with G key
@@ -168,65 +565,128 @@ int main() {
         // ================================
         // LOGIC COMPUTATION
         // ================================
-        wiringSystem.UpdateSignals(gates);
+        if (threadedSimulation) {
+            if (netlistDirty) {
+                // Hand the simulation thread a fresh compile of the canvas, seeded with the inputs
+                vector<GateHandle> nodeGates;
+                CircuitDescription description = wiringSystem.DescribeCircuit(gates, "canvas", &nodeGates);
+                auto circuit = make_shared<const CompiledCircuit>(CompileCircuit(description, SUBCIRCUITS));
+                vector<int> inputNodes;
+                vector<BusWord> sentInputs;
+                vector<pair<int, BusWord>> inputValues;
+                for (int n = 0; n < (int)nodeGates.size(); n++) {
+                    const Gate& gate = **gates.Get(nodeGates[n]);
+                    if (gate.GetType() != GateType::INPUT) continue;
+                    inputNodes.push_back(n);
+                    sentInputs.push_back(gate.input1);
+                    inputValues.push_back({ circuit->nodeOutputNets[n], gate.input1 });
+                }
+
+                unsigned long long version = simulation.Load(circuit, move(inputValues));
+                if (version != 0) {
+                    simCircuit = circuit;
+                    simDescription = move(description);
+                    simNodeGates = move(nodeGates);
+                    simInputNodes = move(inputNodes);
+                    simSentInputs = move(sentInputs);
+                    simVersion = version;
+                    netlistDirty = false;
+                }
+            }
+            else {
+                // Forward INPUT clicks as net writes
+                for (size_t i = 0; i < simInputNodes.size(); i++) {
+                    int node = simInputNodes[i];
+                    const unique_ptr<Gate>* gate = gates.Get(simNodeGates[node]);
+                    if (gate && (*gate)->input1 != simSentInputs[i] &&
+                        simulation.SetNet(simCircuit->nodeOutputNets[node], (*gate)->input1)) {
+                        simSentInputs[i] = (*gate)->input1;
+                    }
+                }
+            }
+
+            // Show the newest results that belong to the current compile
+            if (simulation.Refresh() && simulation.Latest().version == simVersion && simCircuit) {
+                const SimulationSnapshot& snapshot = simulation.Latest();
+                wiringSystem.ApplyNetValues(gates, simNodeGates, *simCircuit, snapshot.nets,
+                    snapshot.unknown.empty() ? nullptr : &snapshot.unknown);
+                if (showHeatmap) wiringSystem.ApplyCoverage(simNodeGates, *simCircuit, simulation.Latest().coverage);
+            }
+        }
+        else {
+            wiringSystem.UpdateSignals(gates);
+        }
+
+        // Pick up routes finished by the background worker
+        wiringSystem.ApplyRouteResults();
+
+        // Re-time whatever this frame's edits touched
+        wiringSystem.UpdateTiming(gates, showCriticalPath);
 
         // ================================
         // RENDERING
         // ================================
+
+        // Redraw whatever part of the cached gate/wire layer went stale
+        canvasCache.Update(sceneRenderer, gates, wiringSystem, draggedGate, viewport);
+
         BeginDrawing();
         ClearBackground(LIGHTGRAY);
 
         // Draw grid if enabled (like Proteus)
         if (showGrid) {
-            // Draw vertical grid lines
-            for (int x = SIDEBAR_WIDTH; x < SCREEN_WIDTH; x += GRID_SIZE) {
-                DrawLine(x, 0, x, SCREEN_HEIGHT, ColorAlpha(GRAY, 0.3f));
-            }
-            
-            // Draw horizontal grid lines
-            for (int y = 0; y < SCREEN_HEIGHT; y += GRID_SIZE) {
-                DrawLine(SIDEBAR_WIDTH, y, SCREEN_WIDTH, y, ColorAlpha(GRAY, 0.3f));
-            }
-            
-            // Draw thicker lines every 5 grid units (like Proteus major grid)
-            for (int x = SIDEBAR_WIDTH; x < SCREEN_WIDTH; x += GRID_SIZE * 5) {
-                DrawLine(x, 0, x, SCREEN_HEIGHT, ColorAlpha(DARKGRAY, 0.5f));
-            }
-            
-            for (int y = 0; y < SCREEN_HEIGHT; y += GRID_SIZE * 5) {
-                DrawLine(SIDEBAR_WIDTH, y, SCREEN_WIDTH, y, ColorAlpha(DARKGRAY, 0.5f));
-            }
+            canvasCache.DrawGrid(viewport);
         }
 
-        // Draw sidebar
-        sidebar.Draw(hasSelectedGate, selectedGateType, currentMode);
+        // Composite the cached gates and wires
+        canvasCache.DrawScene();
 
-        // Draw all placed gates
-        for (int i = 0; i < gates.size(); i++) {
-            bool highlight = (draggedGateIndex == i);
-            gates[i]->Draw(false, highlight);
-        }
+        // Live world-space drawing, clipped to the area right of the sidebar
+        viewport.BeginWorld();
 
-        // Draw wires
-        wiringSystem.DrawWires(gates, mousePos);
+        // Draw the dragged gate and its wires with a highlight
+        sceneRenderer.DrawLive(gates);
+
+        // Draw the wire being created
+        wiringSystem.DrawWirePreview(gates, worldMouse);
 
         // Draw preview gate when hovering in main area (placement mode only)
-        if (currentMode == SimulatorMode::PLACEMENT && hasSelectedGate && mousePos.x > SIDEBAR_WIDTH && draggedGateIndex == -1) {
-            Vector2 gateSize = GATE_DATA.at(selectedGateType).size;
-            Gate previewGate(selectedGateType, { mousePos.x - gateSize.x / 2, mousePos.y - gateSize.y / 2 });
+        if (currentMode == SimulatorMode::PLACEMENT && hasSelectedGate && mousePos.x > SIDEBAR_WIDTH && !draggedGate.IsValid()) {
+            Gate previewGate(selectedGateType, { 0, 0 }, selectedDefinition, selectedWidth);
+            Vector2 gateSize = previewGate.GetSize();
+            previewGate.position = { worldMouse.x - gateSize.x / 2, worldMouse.y - gateSize.y / 2 };
             previewGate.Draw(true); // true = preview mode
         }
 
+        // Outline the selection, and the rectangle being dragged out
+        float pixel = 1.0f / viewport.GetZoom();
+        sceneRenderer.DrawSelection(gates, selection, viewport.GetVisibleWorldRect(), 2 * pixel);
+        if (selecting) {
+            Rectangle band = RectBetween(selectionStart, worldMouse);
+            DrawRectangleRec(band, Fade(SELECTION_COLOR, 0.15f));
+            DrawRectangleLinesEx(band, pixel, SELECTION_COLOR);
+        }
+
         // Highlight connection points in wiring mode
         if (currentMode == SimulatorMode::WIRING) {
-            wiringSystem.HighlightConnectionPoints(gates, mousePos);
+            wiringSystem.HighlightConnectionPoints(gates, worldMouse);
         }
 
+        viewport.EndWorld();
+
+        // Draw sidebar
+        sidebar.Draw(hasSelectedGate, selectedGateType, currentMode, selectedDefinition);
+
         // Draw UI information
         string statusText = "Mode: " + string(currentMode == SimulatorMode::PLACEMENT ? "PLACEMENT" : "WIRING");
         if (currentMode == SimulatorMode::PLACEMENT) {
-            if (hasSelectedGate) {
+            const CompiledCircuit* selectedBlock = SUBCIRCUITS.Get(selectedDefinition);
+            if (hasSelectedGate && selectedGateType == GateType::SUBCIRCUIT && selectedBlock) {
+                statusText += " | Selected: " + selectedBlock->name + " (" + to_string(selectedBlock->flattenedGates) + " gates)";
+            }
+            else if (hasSelectedGate) {
                 statusText += " | Selected: " + string(GATE_DATA.at(selectedGateType).label);
+                if (selectedWidth > 1) statusText += " x" + to_string(selectedWidth) + " bus";
             }
             else {
                 statusText += " | Selected: None";
@@ -236,34 +696,96 @@ int main() {
             statusText += " | Click output then input to connect";
         }
         
+        if (threadedSimulation) {
+            double rate = SIMULATION_TICK_RATES[tickRateIndex];
+            statusText += " | Sim: " + (rate > 0 ? to_string((long long)rate) + " t/s" : string("MAX"))
+                + (simulation.Latest().settled ? string(" (settled)")
+                    : " (" + to_string((long long)simulation.Latest().ticksPerSecond) + " t/s)");
+        }
+        else {
+            statusText += " | Sim: per frame";
+        }
+        if (showHeatmap && simCircuit) {
+            size_t toggledBits = 0, totalBits = 0;
+            CountToggledBits(*simCircuit, simulation.Latest().coverage, toggledBits, totalBits);
+            statusText += " | Toggled: " + to_string(toggledBits) + "/" + to_string(totalBits) + " bits";
+        }
+        if (fourValued && simCircuit) {
+            const SimulationSnapshot& snapshot = simulation.Latest();
+            size_t floatingPins = 0, unknownNets = 0;
+            if (snapshot.version == simVersion && !snapshot.unknown.empty()) {
+                for (int net : simCircuit->inputPinNets) {
+                    if (snapshot.unknown[net] & ~snapshot.nets[net] & BusMask(simCircuit->netWidths[net])) floatingPins++;
+                }
+                for (size_t net = 1; net < snapshot.unknown.size(); net++) {
+                    if (snapshot.unknown[net] & snapshot.nets[net]) unknownNets++;
+                }
+            }
+            statusText += " | 4-valued: " + to_string(floatingPins) + " floating pins, " + to_string(unknownNets) + " X nets";
+        }
+        if (showCriticalPath) {
+            float critical = wiringSystem.GetCriticalDelay();
+            char criticalText[64];
+            snprintf(criticalText, sizeof(criticalText), "%.1f ns over %d gates", critical,
+                (int)wiringSystem.GetCriticalPathGates());
+            statusText += " | Critical: " + string(critical >= 0 ? criticalText : "none");
+        }
+        if (wiringSystem.GetLoopCount() > 0) {
+            statusText += " | Loops: " + to_string(wiringSystem.GetLoopCount());
+        }
+        if (!selection.empty()) {
+            statusText += " | Selection: " + to_string(selection.size()) + " gates (Ctrl+D x" + to_string(replicateCopies) + ")";
+        }
         statusText += " | Grid: " + string(showGrid ? "ON" : "OFF");
+        if (!fileStatus.empty()) statusText += " | " + fileStatus;
+        statusText += " | Zoom: " + to_string((int)roundf(viewport.GetZoom() * 100)) + "%";
         
         DrawText(statusText.c_str(), SIDEBAR_WIDTH + 10, 10, 16, BLACK);
 
         // Show controls
-        DrawText("Controls: DEL = Delete selected gate, Right-click = Delete wire, G = Toggle grid",
+        DrawText("Controls: Drag empty canvas = Select, DEL = Delete selected, Ctrl+A/C/V = Select all/Copy/Paste, Ctrl+D = Replicate toward mouse, , . = Copies, Right-click = Delete wire, Ctrl+Z/Ctrl+Y = Undo/Redo, Ctrl+S/Ctrl+O = Save/Load, B = Make block, [ ] = Bus width, T = Threaded sim, -/= = Tick rate, F5/F9 = Checkpoint/Restore, H = Toggle heatmap, F6 = Coverage report, X = 0/1/X/Z sim, P = Critical path, G = Toggle grid, R = Reroute all wires, Wheel = Zoom, Middle-drag = Pan, Home = Reset view",
             SIDEBAR_WIDTH + 10, SCREEN_HEIGHT - 30, 12, DARKGRAY);
 
         // Debug texture info
         if (IsKeyDown(KEY_F1)) {
             int y = 60;
             DrawText("TEXTURE DEBUG (F1)", SIDEBAR_WIDTH + 500, 10, 20, RED);
+            std::string atlasInfo = "Atlas ID: " + std::to_string(GATE_ATLAS.id) + " ("
+                + std::to_string(GATE_ATLAS.width) + "x" + std::to_string(GATE_ATLAS.height) + ")";
+            DrawText(atlasInfo.c_str(), SIDEBAR_WIDTH + 500, 40, 10, BLACK);
             for (const auto& pair : GATE_DATA) {
+                const Rectangle& rect = pair.second.atlasRect;
                 std::string info = pair.second.label;
                 info += " Texture ID: " + std::to_string(pair.second.texture.id);
                 if (pair.second.texture.id != 0) {
-                    info += " (" + std::to_string(pair.second.texture.width) + "x" 
-                         + std::to_string(pair.second.texture.height) + ")";
+                    info += " at " + std::to_string((int)rect.x) + "," + std::to_string((int)rect.y)
+                         + " (" + std::to_string((int)rect.width) + "x" + std::to_string((int)rect.height) + ")";
                 }
                 DrawText(info.c_str(), SIDEBAR_WIDTH + 500, y, 10, BLACK);
                 y += 20;
             }
         }
 
+        // Nothing to show until the user does something: no input, no signal or route
+        // changes this frame, no routes in flight and a simulation that has settled
+        // (background engines only start work when the UI asks). Sleep in raylib's
+        // event wait instead of redrawing at 60 FPS.
+        bool idle = !HadInput() && !netlistDirty && !wiringSystem.HasPendingRoutes() &&
+            wiringSystem.GetStateRevision() == frameStateRevision &&
+            wiringSystem.GetRouteRevision() == frameRouteRevision &&
+            (!threadedSimulation || simulation.IsIdle());
+        if (idle != waitingForEvents) {
+            waitingForEvents = idle;
+            if (idle) EnableEventWaiting();
+            else DisableEventWaiting();
+        }
+
         EndDrawing();
     }
 
     // Unload resources
+    canvasCache.Unload();
+    sceneRenderer.Unload();
     UnloadGateTextures();
 
     // Cleanup
@@ -0,0 +1,109 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ================================
+// READ-ONLY MEMORY-MAPPED FILE
+// ================================
+
+// Maps a whole file for reading. Pages are read in by the OS as they are
+// touched, so the file is never loaded up front, and Discard lets a
+// sequential reader hand pages it is done with back to the OS so the
+// resident size stays flat however large the file is.
+class MappedFile {
+private:
+    const char* data = nullptr;
+    size_t size = 0;
+    size_t discarded = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+
+public:
+    MappedFile() {}
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // False if the file can't be opened or mapped (an empty file maps to no data)
+    bool Open(const std::string& path) {
+        Close();
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize)) return false;
+        size = (size_t)fileSize.QuadPart;
+        if (size == 0) return true;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) return false;
+        data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        return data != nullptr;
+#else
+        int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) return false;
+        struct stat info;
+        if (fstat(descriptor, &info) != 0) {
+            close(descriptor);
+            return false;
+        }
+        size = (size_t)info.st_size;
+        if (size > 0) {
+            void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapped != MAP_FAILED) {
+                data = (const char*)mapped;
+                madvise(mapped, size, MADV_SEQUENTIAL);
+            }
+        }
+        close(descriptor);   // The mapping keeps the file alive
+        return size == 0 || data != nullptr;
+#endif
+    }
+
+    void Close() {
+#ifdef _WIN32
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (data) munmap((void*)data, size);
+#endif
+        data = nullptr;
+        size = 0;
+        discarded = 0;
+    }
+
+    const char* Data() const { return data; }
+    size_t Size() const { return size; }
+
+    // Release the pages before offset; they are read again from disk if touched
+    void Discard(size_t offset) {
+#ifdef _WIN32
+        (void)offset;   // Windows trims clean file pages from the working set on its own
+#else
+        size_t page = (size_t)sysconf(_SC_PAGESIZE);
+        size_t end = offset / page * page;
+        if (!data || end <= discarded) return;
+        madvise((void*)(data + discarded), end - discarded, MADV_DONTNEED);
+        discarded = end;
+#endif
+    }
+};
+
+#endif // MAPPED_FILE_H
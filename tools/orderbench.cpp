@@ -0,0 +1,187 @@
+// Evaluation order benchmark: compiles generated netlists in level (Kahn) order
+// and depth-first order, checks both give the same outputs, and times a full
+// Step of each, so CompileCircuit's automatic choice can be checked.
+//
+//   orderbench [gates]        (default 2000000)
+//
+// Four designs of about that many gates:
+//   adders, placed        64-bit NAND ripple adders, nodes in the order a cell
+//                         is built (as on the canvas)
+//   adders, shuffled      the same with node order randomised (imported netlists)
+//   random, placed        random logic where each gate reads one of the 300
+//                         before it, nodes in that order
+//   random, shuffled      the same with node order randomised
+//
+// For each order it prints ns per op (best of 5 timed passes) and its far reads:
+// reads of a net more than an L1's worth of nets from the op's own output, or
+// written more than that many ops earlier (the measure CompileCircuit uses).
+// "auto" names the order CompileCircuit picked by itself.
+//
+// Uses only the raylib-free netlist code, so it builds on its own:
+//   g++ -std=c++14 -O2 -ITESTSIMULAtor tools/orderbench.cpp TESTSIMULAtor/Netlist.cpp -o orderbench
+
+#include "Netlist.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+static const int LOCAL_NETS = 32 * 1024 / (int)sizeof(BusWord);
+static const int TIMED_PASSES = 5;
+
+// Randomise node order, as an imported netlist would have it
+static void ShuffleNodes(CircuitDescription& description, std::mt19937& rng) {
+    std::vector<int> moved(description.nodes.size());
+    for (size_t n = 0; n < moved.size(); n++) moved[n] = (int)n;
+    std::shuffle(moved.begin(), moved.end(), rng);
+
+    std::vector<NetlistNode> nodes(description.nodes.size());
+    for (size_t n = 0; n < moved.size(); n++) nodes[moved[n]] = description.nodes[n];
+    description.nodes.swap(nodes);
+    for (NetlistEdge& edge : description.edges) {
+        edge.fromNode = moved[edge.fromNode];
+        edge.toNode = moved[edge.toNode];
+    }
+}
+
+static int AddNode(CircuitDescription& description, GateType type) {
+    NetlistNode node;
+    node.type = type;
+    description.nodes.push_back(node);
+    return (int)description.nodes.size() - 1;
+}
+
+// count ripple adders of bits full adders, nine NANDs each
+static CircuitDescription Adders(int count, int bits) {
+    CircuitDescription description;
+    auto wire = [&description](int from, int to, int port) { description.edges.push_back({ from, 0, to, port }); };
+    for (int a = 0; a < count; a++) {
+        int carry = AddNode(description, GateType::INPUT);
+        for (int b = 0; b < bits; b++) {
+            int x = AddNode(description, GateType::INPUT), y = AddNode(description, GateType::INPUT);
+            int gate[9];
+            for (int& g : gate) g = AddNode(description, GateType::NAND);
+            wire(x, gate[0], 0); wire(y, gate[0], 1);
+            wire(x, gate[1], 0); wire(gate[0], gate[1], 1);
+            wire(y, gate[2], 0); wire(gate[0], gate[2], 1);
+            wire(gate[1], gate[3], 0); wire(gate[2], gate[3], 1);              // x ^ y
+            wire(gate[3], gate[4], 0); wire(carry, gate[4], 1);
+            wire(gate[3], gate[5], 0); wire(gate[4], gate[5], 1);
+            wire(carry, gate[6], 0); wire(gate[4], gate[6], 1);
+            wire(gate[5], gate[7], 0); wire(gate[6], gate[7], 1);              // sum
+            wire(gate[4], gate[8], 0); wire(gate[0], gate[8], 1);              // carry out
+            wire(gate[7], AddNode(description, GateType::OUTPUT), 0);
+            carry = gate[8];
+        }
+        wire(carry, AddNode(description, GateType::OUTPUT), 0);
+    }
+    return description;
+}
+
+// Local random logic: every gate reads from the 300 nodes before it
+static CircuitDescription RandomLogic(int gates, std::mt19937& rng) {
+    static const GateType TYPES[] = { GateType::AND, GateType::OR, GateType::NOT, GateType::NAND, GateType::NOR };
+    static const int PORTS = 1024;
+    CircuitDescription description;
+    for (int i = 0; i < PORTS; i++) AddNode(description, GateType::INPUT);
+    for (int i = 0; i < gates; i++) {
+        GateType type = TYPES[rng() % 5];
+        int node = AddNode(description, type);
+        for (int port = 0; port < PrimitiveInputCount(type); port++) {
+            description.edges.push_back({ node - 1 - (int)(rng() % std::min(node, 300)), 0, node, port });
+        }
+    }
+    int lastGate = (int)description.nodes.size() - 1;
+    for (int i = 0; i < PORTS; i++) {
+        description.edges.push_back({ lastGate - i, 0, AddNode(description, GateType::OUTPUT), 0 });
+    }
+    return description;
+}
+
+// Far reads of a compiled circuit, over its ops in evaluation order
+static size_t FarReads(const CompiledCircuit& circuit) {
+    std::vector<int> writtenAt(circuit.netCount, -1);
+    size_t far = 0;
+    for (int i = 0; i < (int)circuit.ops.size(); i++) {
+        const CompiledOp& op = circuit.ops[i];
+        const int* pin = &circuit.pins[op.firstPin];
+        int written = pin[op.inputCount];
+        for (int p = 0; p < op.inputCount; p++) {
+            bool distant = std::abs(written - pin[p]) > LOCAL_NETS;
+            bool stale = writtenAt[pin[p]] >= 0 && i - writtenAt[pin[p]] > LOCAL_NETS;
+            if (pin[p] != 0 && (distant || stale)) far++;
+        }
+        for (int o = 0; o < op.outputCount; o++) writtenAt[pin[op.inputCount + o]] = i;
+    }
+    return far;
+}
+
+// Same ops and nets, so the same order
+static bool SameCompile(const CompiledCircuit& a, const CompiledCircuit& b) {
+    return a.netCount == b.netCount && a.pins == b.pins && a.inputNets == b.inputNets;
+}
+
+// Best time of a full Step, in ns per op; outputs receives the last pass's output values
+static double TimeSteps(const SubcircuitLibrary& library, const CompiledCircuit& circuit,
+    std::vector<BusWord>& outputs) {
+    std::vector<BusWord> nets(circuit.scratchNets, 0);
+    int reps = std::max(3, (int)(20000000 / std::max<size_t>(circuit.ops.size(), 1)));
+    double best = 1e30;
+    for (int pass = 0; pass < TIMED_PASSES; pass++) {
+        std::mt19937 inputs(7);     // Same stimulus for every order
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            for (int net : circuit.inputNets) nets[net] = inputs() & 1;
+            library.Step(circuit, nets);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, seconds);
+    }
+    outputs.clear();
+    for (int net : circuit.outputNets) outputs.push_back(nets[net]);
+    return best * 1e9 / reps / std::max<size_t>(circuit.ops.size(), 1);
+}
+
+static bool Run(const char* name, const CircuitDescription& description) {
+    SubcircuitLibrary library;
+    CompiledCircuit level = CompileCircuit(description, library, EvaluationOrder::LEVEL);
+    CompiledCircuit depthFirst = CompileCircuit(description, library, EvaluationOrder::DEPTH_FIRST);
+    CompiledCircuit chosen = CompileCircuit(description, library);
+
+    std::vector<BusWord> levelOutputs, depthFirstOutputs;
+    double levelTime = TimeSteps(library, level, levelOutputs);
+    double depthFirstTime = TimeSteps(library, depthFirst, depthFirstOutputs);
+    const char* picked = SameCompile(chosen, depthFirst) ? "depth first" : SameCompile(chosen, level) ? "level" : "?";
+
+    printf("%-18s %8zu ops   level %6.2f ns/op %9zu far   depth first %6.2f ns/op %9zu far   auto: %s\n",
+        name, level.ops.size(), levelTime, FarReads(level), depthFirstTime, FarReads(depthFirst), picked);
+    if (levelOutputs != depthFirstOutputs) {
+        fprintf(stderr, "%s: orders disagree on the outputs\n", name);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int gates = (argc > 1) ? atoi(argv[1]) : 2000000;
+    if (gates < 1000) {
+        fprintf(stderr, "usage: orderbench [gates >= 1000]\n");
+        return 2;
+    }
+
+    std::mt19937 rng(5);
+    bool ok = true;
+    CircuitDescription adders = Adders(std::max(1, gates / (9 * 64)), 64);
+    ok &= Run("adders, placed", adders);
+    ShuffleNodes(adders, rng);
+    ok &= Run("adders, shuffled", adders);
+
+    CircuitDescription random = RandomLogic(gates, rng);
+    ok &= Run("random, placed", random);
+    ShuffleNodes(random, rng);
+    ok &= Run("random, shuffled", random);
+    return ok ? 0 : 1;
+}
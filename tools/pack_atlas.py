@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""Pack the gate images into one atlas and embed it as TESTSIMULAtor/GateAtlasData.h.
+
+Run from anywhere after changing anything in resources/:
+
+    python tools/pack_atlas.py
+
+Besides the gate images the atlas holds the sprites used for batched drawing:
+a solid white block, an anti-aliased disc, and two empty slots that the program
+fills with the 0/1 state digits from raylib's default font before uploading.
+Only the standard library is used, so no extra packages are needed.
+"""
+import math
+import os
+import struct
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+RESOURCES = os.path.join(ROOT, "resources")
+OUTPUT = os.path.join(ROOT, "TESTSIMULAtor", "GateAtlasData.h")
+
+ATLAS_WIDTH = 512
+PADDING = 2
+DISC_SIZE = 32
+DIGIT_SLOT = 32
+WHITE_SIZE = 8
+WHITE_INSET = 2
+
+# (macro suffix, file) in GateType order
+GATE_IMAGES = [
+    ("AND", "and_gate.png"),
+    ("OR", "or_gate.png"),
+    ("NOT", "not_gate.png"),
+    ("NAND", "nand_gate.png"),
+    ("NOR", "nor_gate.png"),
+]
+
+
+def read_png(path):
+    """Decode a non-interlaced 8-bit PNG into (width, height, RGBA rows)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(path + ": not a PNG file")
+
+    pos = 8
+    idat = b""
+    width = height = color_type = None
+    palette = transparency = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or interlace != 0:
+                raise ValueError(path + ": only 8-bit non-interlaced PNGs are supported")
+        elif kind == b"PLTE":
+            palette = body
+        elif kind == b"tRNS":
+            transparency = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        offset = y * (stride + 1)
+        kind = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        for x in range(stride):
+            left = line[x - channels] if x >= channels else 0
+            up = previous[x]
+            upper_left = previous[x - channels] if x >= channels else 0
+            if kind == 1:
+                line[x] = (line[x] + left) & 0xFF
+            elif kind == 2:
+                line[x] = (line[x] + up) & 0xFF
+            elif kind == 3:
+                line[x] = (line[x] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                p = left + up - upper_left
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - upper_left)
+                predictor = left if pa <= pb and pa <= pc else (up if pb <= pc else upper_left)
+                line[x] = (line[x] + predictor) & 0xFF
+        previous = line
+
+        rgba = bytearray()
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color_type == 6:
+                rgba += px
+            elif color_type == 2:
+                rgba += px + b"\xff"
+            elif color_type == 4:
+                rgba += bytes((px[0], px[0], px[0], px[1]))
+            elif color_type == 0:
+                rgba += bytes((px[0], px[0], px[0], 255))
+            else:
+                index = px[0]
+                alpha = transparency[index] if transparency and index < len(transparency) else 255
+                rgba += palette[index * 3:index * 3 + 3] + bytes((alpha,))
+        rows.append(rgba)
+    return width, height, rows
+
+
+def write_png(width, height, rows):
+    """Encode RGBA rows as a PNG byte string."""
+    def chunk(kind, body):
+        return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body) & 0xFFFFFFFF)
+
+    raw = b"".join(b"\x00" + bytes(row) for row in rows)
+    return (b"\x89PNG\r\n\x1a\n"
+            + chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 6, 0, 0, 0))
+            + chunk(b"IDAT", zlib.compress(raw, 9))
+            + chunk(b"IEND", b""))
+
+
+def solid(size, rgba):
+    return size, size, [bytearray(rgba * size) for _ in range(size)]
+
+
+def disc(size):
+    """White disc with an anti-aliased edge filling a size x size image."""
+    radius = size * 0.5
+    rows = []
+    for y in range(size):
+        row = bytearray()
+        for x in range(size):
+            dx, dy = x + 0.5 - radius, y + 0.5 - radius
+            coverage = max(0.0, min(1.0, radius - math.sqrt(dx * dx + dy * dy) + 0.5))
+            row += bytes((255, 255, 255, int(coverage * 255)))
+        rows.append(row)
+    return size, size, rows
+
+
+def main():
+    # name, image, inset rect reported instead of the full image (or None)
+    entries = []
+    for name, filename in GATE_IMAGES:
+        entries.append((name, read_png(os.path.join(RESOURCES, filename)), None))
+    entries.append(("WHITE", solid(WHITE_SIZE, b"\xff\xff\xff\xff"),
+                    (WHITE_INSET, WHITE_INSET, WHITE_SIZE - 2 * WHITE_INSET, WHITE_SIZE - 2 * WHITE_INSET)))
+    entries.append(("DISC", disc(DISC_SIZE), None))
+    entries.append(("DIGIT_SLOT_0", solid(DIGIT_SLOT, b"\x00\x00\x00\x00"), None))
+    entries.append(("DIGIT_SLOT_1", solid(DIGIT_SLOT, b"\x00\x00\x00\x00"), None))
+
+    # Shelf packing, left to right then top to bottom
+    placed = []
+    x = y = PADDING
+    row_height = 0
+    for name, image, inset in entries:
+        width, height, _ = image
+        if x + width + PADDING > ATLAS_WIDTH:
+            x = PADDING
+            y += row_height + PADDING
+            row_height = 0
+        placed.append((name, image, inset, x, y))
+        x += width + PADDING
+        row_height = max(row_height, height)
+
+    atlas_height = 1
+    while atlas_height < y + row_height + PADDING:
+        atlas_height *= 2
+
+    pixels = [bytearray(ATLAS_WIDTH * 4) for _ in range(atlas_height)]
+    for name, (width, height, rows), inset, px, py in placed:
+        for row in range(height):
+            pixels[py + row][px * 4:(px + width) * 4] = rows[row]
+
+    png = write_png(ATLAS_WIDTH, atlas_height, pixels)
+
+    lines = [
+        "// Generated by tools/pack_atlas.py from resources/*.png - do not edit by hand.",
+        "#ifndef GATE_ATLAS_DATA_H",
+        "#define GATE_ATLAS_DATA_H",
+        "",
+        "// Atlas size in pixels",
+        "#define GATE_ATLAS_WIDTH %d" % ATLAS_WIDTH,
+        "#define GATE_ATLAS_HEIGHT %d" % atlas_height,
+        "",
+        "// Source rectangles in atlas pixels: { x, y, width, height }",
+    ]
+    for name, (width, height, _), inset, px, py in placed:
+        if inset:
+            rect = (px + inset[0], py + inset[1], inset[2], inset[3])
+        else:
+            rect = (px, py, width, height)
+        lines.append("#define GATE_ATLAS_RECT_%s { %d, %d, %d, %d }" % ((name,) + rect))
+    lines += [
+        "",
+        "// Atlas image (PNG, %d bytes)" % len(png),
+        "static const int GATE_ATLAS_PNG_SIZE = %d;" % len(png),
+        "static const unsigned char GATE_ATLAS_PNG[] = {",
+    ]
+    for i in range(0, len(png), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in png[i:i + 16]) + ",")
+    lines += ["};", "", "#endif // GATE_ATLAS_DATA_H", ""]
+
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write("\n".join(lines))
+    print("Wrote %s (%dx%d atlas, %d byte PNG)" % (OUTPUT, ATLAS_WIDTH, atlas_height, len(png)))
+
+
+if __name__ == "__main__":
+    main()
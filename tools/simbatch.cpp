@@ -0,0 +1,456 @@
+// Headless batch runner: simulates a saved circuit against a stimulus file
+// without opening a window, for regression runs on build servers.
+//
+//   simbatch <circuit.lsim> <stimulus.txt> [-o outputs.txt] [--ticks N]
+//            [--restore state.ckpt] [--checkpoint state.ckpt] [--coverage report.txt]
+//            [--no-lut]
+//
+// Stimulus file, one record per line ('#' starts a comment):
+//   <v0> <v1> ...     values for the INPUT ports in port order (hex), then
+//                     --ticks passes (default 1) and one line of outputs
+//   run <N>           N more passes with the inputs held (sequential designs),
+//                     then one line of outputs
+//
+// Output lines hold the OUTPUT port values in port order, in hex. Ports are
+// the circuit's INPUT/OUTPUT gates from top to bottom, then left to right.
+// Throughput, evaluator load and peak memory go to stderr.
+//
+// --restore starts from a checkpoint instead of all-low nets (taken by the
+// editor with F5 or by an earlier --checkpoint run of the same circuit), and
+// --checkpoint saves the final state, so long runs can be split or branched.
+// --coverage counts every net's toggles on every tick and writes a report of
+// switching activity, flagging net bits the stimulus never toggled.
+//
+// Only the output ports are read otherwise, so cones of one-bit gates are
+// folded into 6-input lookup tables first (see MapLuts); --no-lut turns that
+// off. Outputs and checkpoints are the same either way.
+//
+// Runs as a three-stage pipeline so parsing and formatting stay off the
+// simulation's critical path: a decoder thread parses the memory-mapped
+// stimulus into packed input words, an evaluator thread simulates them, and
+// the main thread hex-encodes the responses into large writes. Stages pass
+// fixed pools of batches over single-producer rings, so memory stays flat
+// however long the stimulus file is.
+//
+// Uses only the raylib-free netlist code, so it builds on its own:
+//   g++ -std=c++14 -O2 -ITESTSIMULAtor tools/simbatch.cpp TESTSIMULAtor/Netlist.cpp TESTSIMULAtor/CircuitFile.cpp TESTSIMULAtor/Checkpoint.cpp TESTSIMULAtor/Coverage.cpp -pthread -o simbatch
+
+#include "Netlist.h"
+#include "CircuitFile.h"
+#include "Checkpoint.h"
+#include "Coverage.h"
+#include "LockFree.h"
+#include "MappedFile.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// Peak resident memory of this process in kilobytes
+static long long PeakResidentKilobytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return (long long)(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;   // Bytes on macOS
+#else
+    return usage.ru_maxrss;          // Kilobytes on Linux
+#endif
+#endif
+}
+
+static int Usage() {
+    std::cerr << "usage: simbatch <circuit.lsim> <stimulus.txt> [-o outputs.txt] [--ticks N]\n"
+                 "                [--restore state.ckpt] [--checkpoint state.ckpt] [--coverage report.txt]\n"
+                 "                [--no-lut]\n";
+    return 1;
+}
+
+// ================================
+// PIPELINE BATCHES
+// ================================
+
+const size_t BATCH_RECORDS = 4096;           // Stimulus records per batch
+const size_t BATCHES_IN_FLIGHT = 8;          // Per stage; also the ring capacity
+const size_t DISCARD_INTERVAL = 64u << 20;   // Bytes of stimulus between page releases
+const size_t WRITE_BUFFER_BYTES = 1u << 20;
+
+// Decoded stimulus: packed input words for the vector records, in order
+struct StimulusBatch {
+    std::vector<BusWord> inputs;             // inputNets.size() words per vector
+    std::vector<long long> runs;             // Per record: -1 for a vector, else a run count
+    std::string error;                       // Set on the final batch if decoding stopped early
+    bool last = false;
+};
+
+// Simulated responses: outputNets.size() words per record
+struct ResponseBatch {
+    std::vector<BusWord> outputs;
+    std::string error;
+    bool last = false;
+};
+
+// The rings never hold more than the pool, so these only wait on the other stage
+template <typename T>
+static void PushWaiting(SpscQueue<T>& queue, T& item) {
+    while (!queue.Push(std::move(item))) std::this_thread::yield();
+}
+
+template <typename T>
+static void PopWaiting(SpscQueue<T>& queue, T& item) {
+    while (!queue.Pop(item)) std::this_thread::yield();
+}
+
+// ================================
+// STIMULUS DECODER
+// ================================
+
+static int HexDigitValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Parses the mapped stimulus straight from memory into batches; no line copies
+static void DecodeStimulus(MappedFile& stimulus, const CompiledCircuit& circuit,
+    SpscQueue<StimulusBatch>& decoded, SpscQueue<StimulusBatch>& freeBatches) {
+    const size_t inputCount = circuit.inputNets.size();
+    const char* const begin = stimulus.Data();
+    const char* const end = begin + stimulus.Size();
+    const char* p = begin;
+    size_t discardedUpTo = 0;
+    int lineNumber = 1;
+
+    StimulusBatch batch;
+    PopWaiting(freeBatches, batch);
+
+    auto atLineEnd = [&]() { return p == end || *p == '\n' || *p == '#'; };
+    auto skipBlanks = [&]() { while (p != end && IsBlank(*p)) p++; };
+    auto fail = [&](const std::string& message) {
+        batch.error = "line " + std::to_string(lineNumber) + ": " + message;
+    };
+
+    while (p != end && batch.error.empty()) {
+        skipBlanks();
+        if (!atLineEnd()) {
+            if (end - p >= 3 && p[0] == 'r' && p[1] == 'u' && p[2] == 'n' && (end - p == 3 || IsBlank(p[3]))) {
+                // run <N>: anything after the count is ignored
+                p += 3;
+                skipBlanks();
+                long long count = 0;
+                const char* digits = p;
+                while (p != end && *p >= '0' && *p <= '9') count = count * 10 + (*p++ - '0');
+                if (p == digits) {
+                    fail("bad run count");
+                    break;
+                }
+                batch.runs.push_back(count);
+            }
+            else {
+                // An input vector
+                size_t port = 0;
+                while (!atLineEnd()) {
+                    if (end - p >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) p += 2;
+                    BusWord value = 0;
+                    const char* digits = p;
+                    int digit;
+                    while (p != end && (digit = HexDigitValue(*p)) >= 0) {
+                        value = (value << 4) | (BusWord)digit;
+                        p++;
+                    }
+                    if (p == digits || (!atLineEnd() && !IsBlank(*p)) || port >= inputCount) {
+                        port = inputCount + 1;   // Reported below
+                        break;
+                    }
+                    batch.inputs.push_back(value & BusMask(circuit.inputWidths[port]));
+                    port++;
+                    skipBlanks();
+                }
+                if (port != inputCount) {
+                    fail("expected " + std::to_string(inputCount) + " hex values");
+                    break;
+                }
+                batch.runs.push_back(-1);
+            }
+        }
+
+        // Skip the rest of the line, comment included
+        while (p != end && *p != '\n') p++;
+        if (p != end) {
+            p++;
+            lineNumber++;
+        }
+
+        if (batch.runs.size() == BATCH_RECORDS) {
+            PushWaiting(decoded, batch);
+            PopWaiting(freeBatches, batch);
+            if ((size_t)(p - begin) - discardedUpTo >= DISCARD_INTERVAL) {
+                discardedUpTo = (size_t)(p - begin);
+                stimulus.Discard(discardedUpTo);
+            }
+        }
+    }
+
+    batch.last = true;
+    PushWaiting(decoded, batch);
+}
+
+// ================================
+// EVALUATOR
+// ================================
+
+struct EvaluatorStats {
+    unsigned long long vectors = 0;
+    unsigned long long ticks = 0;
+    double busySeconds = 0;                  // Time spent simulating, not waiting on the other stages
+};
+
+static void EvaluateStimulus(const SubcircuitLibrary& library, const CompiledCircuit& circuit, long long ticksPerVector,
+    SpscQueue<StimulusBatch>& decoded, SpscQueue<StimulusBatch>& freeBatches,
+    SpscQueue<ResponseBatch>& responses, SpscQueue<ResponseBatch>& freeResponses,
+    std::vector<BusWord>& nets, ToggleCoverage* coverage, EvaluatorStats& stats) {
+    const size_t inputCount = circuit.inputNets.size();
+    const size_t outputCount = circuit.outputNets.size();
+
+    StimulusBatch batch;
+    ResponseBatch response;
+    do {
+        PopWaiting(decoded, batch);
+        PopWaiting(freeResponses, response);
+        auto start = std::chrono::steady_clock::now();
+
+        response.outputs.clear();
+        const BusWord* inputs = batch.inputs.data();
+        for (long long run : batch.runs) {
+            long long count = run;
+            if (run < 0) {
+                for (size_t i = 0; i < inputCount; i++) nets[circuit.inputNets[i]] = *inputs++;
+                count = ticksPerVector;
+                stats.vectors++;
+            }
+            if (coverage) {
+                for (long long t = 0; t < count; t++) {
+                    library.Step(circuit, nets);
+                    coverage->Sample(nets.data());
+                }
+            }
+            else {
+                for (long long t = 0; t < count; t++) {
+                    library.Step(circuit, nets);
+                }
+            }
+            stats.ticks += (unsigned long long)count;
+            for (size_t o = 0; o < outputCount; o++) {
+                response.outputs.push_back(nets[circuit.outputNets[o]] & BusMask(circuit.outputWidths[o]));
+            }
+        }
+        response.error = batch.error;
+        response.last = batch.last;
+
+        stats.busySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        batch.inputs.clear();
+        batch.runs.clear();
+        batch.error.clear();
+        PushWaiting(responses, response);
+        PushWaiting(freeBatches, batch);
+    } while (!response.last);
+}
+
+// ================================
+// MAIN (response writer)
+// ================================
+
+int main(int argc, char** argv) {
+    std::string circuitPath, stimulusPath, outputPath, restorePath, checkpointPath, coveragePath;
+    long long ticksPerVector = 1;
+    bool mapLuts = true;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) outputPath = argv[++i];
+        else if (arg == "--ticks" && i + 1 < argc) ticksPerVector = std::atoll(argv[++i]);
+        else if (arg == "--restore" && i + 1 < argc) restorePath = argv[++i];
+        else if (arg == "--checkpoint" && i + 1 < argc) checkpointPath = argv[++i];
+        else if (arg == "--coverage" && i + 1 < argc) coveragePath = argv[++i];
+        else if (arg == "--no-lut") mapLuts = false;
+        else if (circuitPath.empty()) circuitPath = arg;
+        else if (stimulusPath.empty()) stimulusPath = arg;
+        else return Usage();
+    }
+    if (circuitPath.empty() || stimulusPath.empty() || ticksPerVector < 1) return Usage();
+
+    // Load and compile
+    CircuitFile file;
+    std::string error = "too many blocks";
+    SubcircuitLibrary library;
+    if (!LoadCircuitFile(circuitPath, file, &error) || !LinkCircuitFile(file, library)) {
+        std::cerr << circuitPath << ": " << error << "\n";
+        return 1;
+    }
+    CompiledCircuit circuit = CompileCircuit(file.circuit, library);
+    if (!coveragePath.empty()) mapLuts = false;   // Coverage reads every net
+    size_t lutCount = mapLuts ? MapLuts(circuit) : 0;
+    if (circuit.hasCycle && ticksPerVector == 1) {
+        std::cerr << "note: circuit has feedback loops; consider --ticks to let it settle\n";
+    }
+
+    // Starting state
+    std::vector<BusWord> nets(circuit.scratchNets, 0);
+    unsigned long long startTick = 0;
+    if (!restorePath.empty() && !LoadCheckpoint(restorePath, circuit, startTick, nets, &error)) {
+        std::cerr << restorePath << ": " << error << "\n";
+        return 1;
+    }
+
+    // Toggles are counted from the starting state on
+    ToggleCoverage coverage;
+    if (!coveragePath.empty()) {
+        coverage.Reset(circuit.netCount);
+        coverage.Sample(nets.data());
+    }
+
+    MappedFile stimulus;
+    if (!stimulus.Open(stimulusPath)) {
+        std::cerr << "cannot open " << stimulusPath << "\n";
+        return 1;
+    }
+
+    FILE* out = stdout;
+    if (!outputPath.empty()) {
+        out = std::fopen(outputPath.c_str(), "wb");
+        if (!out) {
+            std::cerr << "cannot write " << outputPath << "\n";
+            return 1;
+        }
+    }
+
+    // Fill the batch pools up front so the steady state allocates nothing
+    const size_t outputCount = circuit.outputNets.size();
+    SpscQueue<StimulusBatch> decoded(BATCHES_IN_FLIGHT), freeBatches(BATCHES_IN_FLIGHT);
+    SpscQueue<ResponseBatch> responses(BATCHES_IN_FLIGHT), freeResponses(BATCHES_IN_FLIGHT);
+    for (size_t i = 0; i < BATCHES_IN_FLIGHT; i++) {
+        StimulusBatch batch;
+        batch.inputs.reserve(BATCH_RECORDS * circuit.inputNets.size());
+        batch.runs.reserve(BATCH_RECORDS);
+        freeBatches.Push(std::move(batch));
+        ResponseBatch response;
+        response.outputs.reserve(BATCH_RECORDS * outputCount);
+        freeResponses.Push(std::move(response));
+    }
+
+    // Simulate
+    auto start = std::chrono::steady_clock::now();
+    EvaluatorStats stats;
+    std::thread decoder(DecodeStimulus, std::ref(stimulus), std::cref(circuit), std::ref(decoded), std::ref(freeBatches));
+    std::thread evaluator(EvaluateStimulus, std::cref(library), std::cref(circuit), ticksPerVector,
+        std::ref(decoded), std::ref(freeBatches), std::ref(responses), std::ref(freeResponses), std::ref(nets),
+        coveragePath.empty() ? nullptr : &coverage, std::ref(stats));
+
+    // Hex-encode responses into one buffer and hand it to the OS in large writes
+    std::vector<int> digits(outputCount);
+    size_t lineBytes = 1;
+    for (size_t o = 0; o < outputCount; o++) {
+        digits[o] = (circuit.outputWidths[o] + 3) / 4;
+        lineBytes += digits[o] + 1;
+    }
+    std::vector<char> buffer(WRITE_BUFFER_BYTES + lineBytes);
+    size_t used = 0;
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+    error.clear();
+    ResponseBatch response;
+    do {
+        PopWaiting(responses, response);
+        const BusWord* value = response.outputs.data();
+        const BusWord* valueEnd = value + response.outputs.size();
+        while (value != valueEnd) {
+            char* cursor = buffer.data() + used;
+            for (size_t o = 0; o < outputCount; o++) {
+                if (o) *cursor++ = ' ';
+                BusWord word = *value++;
+                for (int d = digits[o] - 1; d >= 0; d--) {
+                    cursor[d] = HEX_DIGITS[word & 15];
+                    word >>= 4;
+                }
+                cursor += digits[o];
+            }
+            *cursor++ = '\n';
+            used = (size_t)(cursor - buffer.data());
+            if (used >= WRITE_BUFFER_BYTES) {
+                std::fwrite(buffer.data(), 1, used, out);
+                used = 0;
+            }
+        }
+        if (response.last) error = response.error;
+        PushWaiting(freeResponses, response);
+    } while (!response.last);
+    std::fwrite(buffer.data(), 1, used, out);
+
+    decoder.join();
+    evaluator.join();
+    bool writeFailed = std::fflush(out) != 0 || std::ferror(out);
+    if (out != stdout) std::fclose(out);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (!error.empty()) {
+        std::cerr << stimulusPath << ": " << error << "\n";
+        return 2;
+    }
+    if (writeFailed) {
+        std::cerr << "cannot write " << (outputPath.empty() ? "outputs" : outputPath) << "\n";
+        return 1;
+    }
+    if (!checkpointPath.empty() && !SaveCheckpoint(checkpointPath, circuit, startTick + stats.ticks, nets, &error)) {
+        std::cerr << checkpointPath << ": " << error << "\n";
+        return 1;
+    }
+
+    if (!coveragePath.empty()) {
+        std::ofstream report(coveragePath);
+        WriteCoverageReport(report, file.circuit, circuit, coverage);
+        if (!report) {
+            std::cerr << "cannot write " << coveragePath << "\n";
+            return 1;
+        }
+    }
+
+    // Report
+    double rateBase = seconds > 0 ? seconds : 1e-9;
+    std::fprintf(stderr, "circuit:   %s (%zu gates flattened, %zu inputs, %zu outputs)\n", circuitPath.c_str(),
+        circuit.flattenedGates, circuit.inputNets.size(), circuit.outputNets.size());
+    if (lutCount > 0) {
+        std::fprintf(stderr, "luts:      %zu (%zu ops mapped to %zu)\n", lutCount, circuit.ops.size(),
+            circuit.mappedOps.size());
+    }
+    std::fprintf(stderr, "vectors:   %llu (%llu ticks) in %.3f s\n", stats.vectors, stats.ticks, seconds);
+    std::fprintf(stderr, "vectors/s: %.0f\n", stats.vectors / rateBase);
+    std::fprintf(stderr, "gates/s:   %.0f\n", (double)circuit.flattenedGates * stats.ticks / rateBase);
+    if (!circuit.stateOps.empty()) std::fprintf(stderr, "cycles/s:  %.0f\n", stats.ticks / rateBase);
+    std::fprintf(stderr, "evaluator: %.0f%% busy\n", 100.0 * stats.busySeconds / rateBase);
+    if (!coveragePath.empty()) {
+        size_t toggledBits = 0, totalBits = 0;
+        CountToggledBits(circuit, coverage, toggledBits, totalBits);
+        std::fprintf(stderr, "coverage:  %zu of %zu net bits toggled\n", toggledBits, totalBits);
+    }
+    std::fprintf(stderr, "peak RSS:  %lld KB\n", PeakResidentKilobytes());
+    return 0;
+}